@@ -0,0 +1,55 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+
+#include "../headers/chunked_minefield.hpp"
+
+/**
+ * Opens mines scattered over a huge area of a `ChunkedMinefield`, 
+ * and reports how many chunks were allocated for them, how long it 
+ * took, and how many chunks could be freed afterwards.
+ */
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/chunks.cpp src/chunked_minefield.cpp
+    */
+
+    using Coord = ChunkedMinefield::Coord;
+
+    const Coord spans[] = { 1000, 1000000, 1000000000 };
+    const int clicks = 10000;
+
+    std::cout << "span\tclicks\topened\tchunks\ttime (ms)\tfreed\n";
+
+    for (auto span : spans) {
+        // A density close to the expert board
+        ChunkedMinefield board { ChunkedMinefield::CHUNK_CELLS / 5 };
+        board.setSeed(0);
+        board.resetAll();
+
+        std::mt19937_64 positions { 0 };
+        std::uniform_int_distribution<Coord> position(-span, span);
+
+        std::size_t opened = 0;
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (int click = 0; click < clicks; ++click)
+            opened += board.open(position(positions), position(positions));
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::size_t chunks = board.getChunkCount();
+        std::size_t freed = board.evictUntouched();
+
+        std::cout << span << "\t" << clicks << "\t" << opened << "\t" 
+                  << chunks << "\t" << elapsed.count() << "\t" << freed << "\n";
+    }
+
+    return 0;
+}
+/////////
@@ -0,0 +1,79 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+
+#include "../headers/minefield.hpp"
+#include "../headers/bitboard.hpp"
+
+/**
+ * Compares how many games per second can be simulated on a `Minefield`
+ * and on a `Bitboard`. 
+ * 
+ * Both boards are played by the same template through `resetAll` and 
+ * `open`/`reveal`, clicking random mines until a bomb is hit or every 
+ * other mine is open.
+ */
+
+template <typename Board>
+double gamesPerSecond(Board& board, int games)
+{
+    std::mt19937 clicks { 0 };
+    std::uniform_int_distribution<int> col(0, board.cols - 1), row(0, board.rows - 1);
+
+    const std::size_t safe = board.cols * board.rows - board.bombs;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int game = 0; game < games; ++game) {
+        board.resetAll();
+
+        std::size_t opened = 0;
+        bool lost = false;
+
+        while (!lost && opened < safe) {
+            int x = col(clicks), y = row(clicks);
+
+            std::size_t count = board.open(x, y);
+            opened += count;
+
+            if (count == 0)
+                lost = board.reveal(x, y);
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return games / elapsed.count();
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/games.cpp src/mine.cpp src/minefield.cpp src/bitboard.cpp src/utils/mapped_file.cpp
+    */
+
+    const std::size_t sizes[][4] = {
+        { 8, 8, 10, 20000 },
+        { 16, 16, 40, 10000 },
+        { 16, 30, 90, 10000 },
+        { 200, 200, 4000, 200 },
+        { 1000, 1000, 100000, 20 }
+    };
+
+    std::cout << "board\tMinefield (games/s)\tBitboard (games/s)\n";
+
+    for (auto [ cols, rows, bombs, games ] : sizes) {
+        Minefield minefield { cols, rows, bombs };
+        Bitboard bitboard { cols, rows, bombs };
+
+        double minefieldRate = gamesPerSecond(minefield, games);
+        double bitboardRate = gamesPerSecond(bitboard, games);
+
+        std::cout << cols << "x" << rows << "\t" << minefieldRate << "\t" << bitboardRate << "\n";
+    }
+
+    return 0;
+}
+/////////
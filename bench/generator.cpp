@@ -0,0 +1,83 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "../headers/difficulty.hpp"
+#include "../headers/generator.hpp"
+
+/**
+ * Times how long a game waits for a board that can be solved without
+ * guessing, on every difficulty preset. A cold start searches after the
+ * first click, and a warm start uses a search that was prepared while
+ * the game before it was played. Hardly any board of the dense preset
+ * can be solved without guessing, so its searches play their whole budget.
+ */
+
+// Returns the time a function takes in milliseconds
+template <typename Function>
+double timeMs(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 -pthread bench/generator.cpp src/generator.cpp src/utils/thread_pool.cpp
+        src/mine.cpp src/minefield.cpp src/difficulty.cpp src/player.cpp src/solver.cpp src/utils/mapped_file.cpp
+    */
+
+    const std::pair<const char *, Difficulty> boards[] = {
+        { "easy", Difficulty::EASY },
+        { "intermediate", Difficulty::INTERMIEDIATE },
+        { "expert", Difficulty::EXPERT },
+        { "expert (30x16, 99)", Difficulty(30, 16, 99) },
+        { "dense (30x16, 130)", Difficulty(30, 16, 130) }
+    };
+
+    const int games = 200;
+
+    std::cout << "board\tcandidates per board\tcold p50 (ms)\tcold p99 (ms)\tcold max (ms)\twarm max (ms)\n";
+
+    for (const auto& [ name, difficulty ] : boards) {
+        Generator generator { difficulty.cols, difficulty.rows, difficulty.bombs };
+
+        int x = difficulty.cols / 2, y = difficulty.rows / 2;
+        std::vector<double> cold, warm;
+
+        for (int game = 0; game < games; ++game)
+            cold.push_back(timeMs([&] { generator.find(x, y, game); }));
+
+        auto candidates = generator.getCandidates();
+
+        for (int game = 0; game < games; ++game) {
+            generator.prepare(x, y, game);
+
+            // The time that a game takes to play, which the search has
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+            warm.push_back(timeMs([&] { generator.find(x, y, game); }));
+        }
+
+        std::sort(cold.begin(), cold.end());
+        std::sort(warm.begin(), warm.end());
+
+        std::cout << name << "\t"
+                  << (double) candidates / games << "\t"
+                  << cold[cold.size() / 2] << "\t"
+                  << cold[cold.size() * 99 / 100] << "\t"
+                  << cold.back() << "\t"
+                  << warm.back() << "\n";
+    }
+
+    return 0;
+}
+/////////
@@ -0,0 +1,74 @@
+#include <iostream>
+#include <chrono>
+
+#include "../headers/minefield.hpp"
+#include "../headers/bitboard.hpp"
+
+/**
+ * Reports the memory that a board takes at different sizes, comparing
+ * the packed one-byte `Mine` with the layout it used to have, and with
+ * a `Bitboard`. It also times `revealAll` and opening the whole board,
+ * which walk over every mine.
+ */
+
+// The layout of a mine when it was an `sf::Drawable` with an enum, a bool and an unsigned int
+struct LegacyMine
+{
+    enum State { Default, Discovered, Flagged };
+
+    virtual ~LegacyMine() = default;
+
+    State state = State::Default;
+    bool bomb = false;
+    unsigned int neighbors = 0;
+};
+
+// Returns the time a function takes in milliseconds
+template <typename Function>
+double timeMs(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/memory.cpp src/mine.cpp src/minefield.cpp src/bitboard.cpp src/utils/mapped_file.cpp
+    */
+
+    const std::size_t sizes[] = { 16, 100, 1000, 4000 };
+
+    std::cout << "sizeof(Mine) " << sizeof(Mine) << ", old layout " << sizeof(LegacyMine) << "\n";
+    std::cout << "board\tmines\told layout (KiB)\tMinefield (KiB)\tBitboard (KiB)\topen (ms)\trevealAll (ms)\n";
+
+    for (auto size : sizes) {
+        // Sparse enough that a single click opens most of the board
+        Minefield board { size, size, size * size / 20 };
+        Bitboard bitboard { size, size, size * size / 20 };
+
+        int center = static_cast<int>(size / 2);
+        board.resetAll(center, center);
+
+        std::size_t opened = 0;
+        double openTime = timeMs([&] { opened = board.open(center, center); });
+        double revealTime = timeMs([&] { board.revealAll(); });
+
+        std::size_t legacy = size * size * sizeof(LegacyMine);
+
+        std::cout << size << "x" << size << "\t" << size * size << "\t"
+                  << legacy / 1024.0 << "\t"
+                  << board.getMemoryUsage() / 1024.0 << "\t"
+                  << bitboard.getMemoryUsage() / 1024.0 << "\t"
+                  << openTime << "\t" << revealTime
+                  << "\t(" << opened << " opened)\n";
+    }
+
+    return 0;
+}
+/////////
@@ -0,0 +1,72 @@
+#include <iostream>
+#include <chrono>
+
+#include "../headers/minefield.hpp"
+
+/**
+ * Compares counting neighbors with a 3x3 loop for every mine (the 
+ * way `reveal` and `revealAll` used to) with the counts that 
+ * `resetAll` now computes when it places the bombs.
+ */
+
+// Returns the time a function takes in milliseconds
+template <typename Function>
+double timeMs(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+// The 3x3 loop that used to run for every revealed mine
+int loopNeighbors(const Minefield& board, int x, int y)
+{
+    int neighbors = 0;
+
+    for (int j = -1; j <= 1; ++j) {
+        for (int i = -1; i <= 1; ++i) {
+            if (board.inBounds(x + i, y + j) && ((i!=0) || (j!=0)))
+                neighbors += board.get(x + i, y + j).bomb;
+        }
+    }
+
+    return neighbors;
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/neighbors.cpp src/mine.cpp src/minefield.cpp src/utils/mapped_file.cpp
+    */
+
+    const std::size_t sizes[] = { 1000, 4000 };
+
+    std::cout << "board\t3x3 loop (ms)\tresetAll (ms)\trevealAll (ms)\n";
+
+    for (auto size : sizes) {
+        Minefield board { size, size, size * size / 5 };
+
+        long long checksum = 0;
+
+        double loopTime = timeMs([&] {
+            for (std::size_t y = 0; y < board.rows; ++y) {
+                for (std::size_t x = 0; x < board.cols; ++x)
+                    checksum += loopNeighbors(board, x, y);
+            }
+        });
+
+        double resetTime = timeMs([&] { board.resetAll(); });
+        double revealTime = timeMs([&] { board.revealAll(); });
+
+        std::cout << size << "x" << size << "\t" 
+                  << loopTime << "\t" << resetTime << "\t" << revealTime 
+                  << "\t(" << checksum << ")\n";
+    }
+
+    return 0;
+}
+/////////
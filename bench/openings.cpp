@@ -0,0 +1,190 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include "../headers/minefield.hpp"
+
+/**
+ * Compares opening mines by spreading from mine to mine (the way `open`
+ * used to) with `open`, which opens an opening in one step from labels
+ * that it finds the first time an opening is opened.
+ *
+ * The first table opens every opening of a huge board. The second one 
+ * times the first click of many fresh games, which labels the board and
+ * opens one opening, and then a click on another opening, which only 
+ * has to write the spans of that opening.
+ */
+
+// Returns the time a function takes in milliseconds
+template <typename Function>
+double timeMs(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+// The stack that used to spread an opening from mine to mine
+std::size_t spread(Minefield& board, int x, int y, std::vector<std::size_t>& frontier)
+{
+    auto canOpen = [](const Mine& mine) {
+        return !mine.discovered() && !mine.bomb && !mine.flagged();
+    };
+
+    if (!canOpen(board.get(x, y)))
+        return 0;
+
+    board.get(x, y).state = Mine::State::Discovered;
+    std::size_t opened = 1;
+
+    frontier.clear();
+
+    if (board.get(x, y).neighbors == 0)
+        frontier.push_back(y * board.cols + x);
+
+    while (!frontier.empty()) {
+        std::size_t index = frontier.back();
+        frontier.pop_back();
+
+        int cx = index % board.cols, cy = index / board.cols;
+
+        for (int j = -1; j <= 1; ++j) {
+            for (int i = -1; i <= 1; ++i) {
+                if (!board.inBounds(cx + i, cy + j))
+                    continue;
+
+                Mine& mine = board.get(cx + i, cy + j);
+
+                if (canOpen(mine)) {
+                    mine.state = Mine::State::Discovered;
+                    opened++;
+
+                    if (mine.neighbors == 0)
+                        frontier.push_back((cy + j) * board.cols + (cx + i));
+                }
+            }
+        }
+    }
+
+    return opened;
+}
+
+// Every mine with no neighboring bombs, in the order they are clicked
+std::vector<std::pair<int, int>> getClicks(Minefield& board)
+{
+    std::vector<std::pair<int, int>> clicks;
+
+    for (std::size_t y = 0; y < board.rows; ++y) {
+        for (std::size_t x = 0; x < board.cols; ++x) {
+            const Mine& mine = board.get(x, y);
+
+            if (!mine.bomb && mine.neighbors == 0)
+                clicks.push_back({ x, y });
+        }
+    }
+
+    return clicks;
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/openings.cpp src/mine.cpp src/minefield.cpp src/utils/mapped_file.cpp
+    */
+
+    const std::pair<std::size_t, std::size_t> boards[] = {
+        { 1000, 1000 * 1000 / 10 },
+        { 1000, 1000 * 1000 / 6 },
+        { 4000, 4000 * 4000 / 10 },
+        { 4000, 4000 * 4000 / 6 }
+    };
+
+    std::cout << "board\topened\tspreading (ms)\tlabels (ms)\n";
+
+    for (auto [ size, bombs ] : boards) {
+        Minefield board { size, size, bombs };
+        board.setSeed(1);
+        board.resetAll();
+
+        auto clicks = getClicks(board);
+        std::vector<std::size_t> frontier;
+
+        std::size_t spreadOpened = 0, labelsOpened = 0;
+
+        double spreadTime = timeMs([&] {
+            for (auto [ x, y ] : clicks)
+                spreadOpened += spread(board, x, y, frontier);
+        });
+
+        // The same board again, with every mine hidden
+        board.setSeed(1);
+        board.resetAll();
+
+        double labelsTime = timeMs([&] {
+            for (auto [ x, y ] : clicks)
+                labelsOpened += board.open(x, y);
+        });
+
+        std::cout << size << "x" << size << "/" << bombs << "\t"
+                  << spreadOpened << (spreadOpened == labelsOpened ? "" : " (mismatch)") << "\t"
+                  << spreadTime << "\t"
+                  << labelsTime << "\n";
+    }
+
+    // The first click of each game is in the middle, where the reset
+    // keeps the mines around it free of bombs
+    const std::size_t games = 20;
+
+    std::cout << "\nboard\tgames\tspreading first click (us)\tlabels first click (us)\t"
+              << "mean second opening\tspreading second click (us)\tlabels second click (us)\n";
+
+    for (auto [ size, bombs ] : boards) {
+        Minefield board { size, size, bombs };
+        std::vector<std::size_t> frontier;
+
+        int x = size / 2, y = size / 2;
+        std::size_t spreadOpened = 0, labelsOpened = 0;
+        double spreadFirst = 0, labelsFirst = 0, spreadSecond = 0, labelsSecond = 0;
+
+        for (std::size_t game = 0; game < games; ++game) {
+            board.setSeed(game);
+            board.resetAll(x, y);
+            spreadFirst += timeMs([&] { spread(board, x, y, frontier); });
+
+            // The second click is on the first opening that is still hidden
+            int sx = 0, sy = 0;
+
+            for (std::size_t i = 0; i < size * size; ++i) {
+                const Mine& mine = board.get(i % size, i / size);
+
+                if (!mine.bomb && mine.neighbors == 0 && !mine.discovered()) {
+                    sx = i % size;
+                    sy = i / size;
+                    break;
+                }
+            }
+
+            spreadSecond += timeMs([&] { spreadOpened += spread(board, sx, sy, frontier); });
+
+            board.setSeed(game);
+            board.resetAll(x, y);
+            labelsFirst += timeMs([&] { board.open(x, y); });
+            labelsSecond += timeMs([&] { labelsOpened += board.open(sx, sy); });
+        }
+
+        std::cout << size << "x" << size << "/" << bombs << "\t"
+                  << games << "\t"
+                  << 1000 * spreadFirst / games << "\t"
+                  << 1000 * labelsFirst / games << "\t"
+                  << (double) labelsOpened / games << (spreadOpened == labelsOpened ? "" : " (mismatch)") << "\t"
+                  << 1000 * spreadSecond / games << "\t"
+                  << 1000 * labelsSecond / games << "\n";
+    }
+
+    return 0;
+}
+/////////
@@ -0,0 +1,88 @@
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+
+#include "../headers/minefield.hpp"
+#include "../headers/utils/random_engine.hpp"
+
+/**
+ * Compares making a first click safe by shuffling all the mines until 
+ * the clicked mine isn't a bomb (the way `Minesweeper::onClick` used to)
+ * with a single `Minefield::resetAll` around the click, on dense boards.
+ */
+
+// Returns the time a function takes in milliseconds
+template <typename Function>
+double timeMs(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+// Shuffles bombs over the board until the clicked mine isn't one, returns the number of shuffles
+int shuffleUntilSafe(std::vector<bool>& bombs, std::size_t count, std::size_t click)
+{
+    int shuffles = 0;
+
+    do {
+        for (std::size_t i = 0; i < bombs.size(); ++i)
+            bombs[i] = (i < count);
+
+        std::shuffle(bombs.begin(), bombs.end(), Random::getEngine());
+        shuffles++;
+    } while (bombs[click]);
+
+    return shuffles;
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/placement.cpp src/mine.cpp src/minefield.cpp src/utils/mapped_file.cpp
+    */
+
+    const std::size_t sizes[][3] = {
+        { 16, 30, 90 },
+        { 16, 30, 240 },
+        { 16, 30, 400 },
+        { 100, 100, 5000 },
+        { 100, 100, 9000 },
+        { 1000, 1000, 500000 },
+        { 1000, 1000, 900000 }
+    };
+
+    const int games = 20;
+
+    std::cout << "board\tbombs\tshuffles\tshuffle (ms)\tresetAll (ms)\n";
+
+    for (auto [ cols, rows, bombs ] : sizes) {
+        Minefield board { cols, rows, bombs };
+        std::vector<bool> cells(cols * rows);
+
+        int x = cols / 2, y = rows / 2;
+        int shuffles = 0;
+
+        double shuffleTime = timeMs([&] {
+            for (int game = 0; game < games; ++game)
+                shuffles += shuffleUntilSafe(cells, bombs, y * cols + x);
+        });
+
+        double resetTime = timeMs([&] {
+            for (int game = 0; game < games; ++game)
+                board.resetAll(x, y);
+        });
+
+        std::cout << cols << "x" << rows << "\t" << bombs << "\t" 
+                  << shuffles / (double) games << "\t" 
+                  << shuffleTime / games << "\t" << resetTime / games << "\n";
+    }
+
+    return 0;
+}
+/////////
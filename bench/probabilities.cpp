@@ -0,0 +1,103 @@
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+
+#include "../headers/difficulty.hpp"
+#include "../headers/probabilities.hpp"
+
+/**
+ * Plays games on every difficulty preset by always revealing the mine
+ * that is least likely to be a bomb, and times the update of the
+ * probabilities after every move.
+ */
+
+// Returns the time a function takes in milliseconds
+template <typename Function>
+double timeMs(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/probabilities.cpp src/mine.cpp src/minefield.cpp src/difficulty.cpp
+        src/probabilities.cpp src/utils/mapped_file.cpp
+    */
+
+    const std::pair<const char *, Difficulty> boards[] = {
+        { "easy", Difficulty::EASY },
+        { "intermediate", Difficulty::INTERMIEDIATE },
+        { "expert", Difficulty::EXPERT },
+        { "expert (30x16, 99)", Difficulty(30, 16, 99) }
+    };
+
+    const int games = 100;
+
+    std::cout << "board\tgames won\tupdates\tp50 (ms)\tp99 (ms)\tmax (ms)\tcache hits\n";
+
+    for (const auto& [ name, difficulty ] : boards) {
+        Minefield board { difficulty.cols, difficulty.rows, difficulty.bombs };
+        board.setSeed(1);
+
+        Probabilities probabilities { board };
+
+        std::vector<double> times;
+        int won = 0;
+
+        for (int game = 0; game < games; ++game) {
+            int x = board.cols / 2, y = board.rows / 2;
+            board.resetAll(x, y);
+
+            std::size_t hidden = board.cols * board.rows;
+            bool lost = false;
+
+            while (!lost && hidden > board.bombs) {
+                lost = board.reveal(x, y);
+
+                times.push_back(timeMs([&] { probabilities.update(); }));
+
+                // The next move is the safest hidden mine
+                double safest = 2;
+                hidden = 0;
+
+                for (std::size_t j = 0; j < board.rows; ++j) {
+                    for (std::size_t i = 0; i < board.cols; ++i) {
+                        if (board.get(i, j).discovered())
+                            continue;
+
+                        hidden++;
+
+                        if (probabilities.get(i, j) < safest) {
+                            safest = probabilities.get(i, j);
+                            x = i;
+                            y = j;
+                        }
+                    }
+                }
+            }
+
+            won += !lost;
+        }
+
+        std::sort(times.begin(), times.end());
+
+        auto hits = probabilities.getCacheHits(), misses = probabilities.getCacheMisses();
+
+        std::cout << name << "\t" << won << "/" << games << "\t" << times.size() << "\t"
+                  << times[times.size() / 2] << "\t"
+                  << times[times.size() * 99 / 100] << "\t"
+                  << times.back() << "\t"
+                  << 100.0 * hits / (hits + misses) << "%\n";
+    }
+
+    return 0;
+}
+/////////
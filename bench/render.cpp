@@ -0,0 +1,110 @@
+#include <iostream>
+#include <functional>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include "../headers/minefield_renderer.hpp"
+
+/**
+ * Compares the frame time of drawing every `Mine` on its own 
+ * (`MinefieldRenderer::drawMines`), batching the whole board 
+ * (`MinefieldRenderer::drawBatched`), and drawing only the mines 
+ * that changed into a cached texture (`MinefieldRenderer::draw`).
+ * 
+ * Frames are drawn into an offscreen texture so that no window 
+ * or vsync gets in the way.
+ */
+
+using DrawFunction = std::function<void(const MinefieldRenderer&, sf::RenderTarget&, sf::RenderStates)>;
+
+// Returns the average time of a frame in milliseconds
+double timeFrames(const MinefieldRenderer& renderer, sf::RenderTexture& target, const DrawFunction& draw, int frames)
+{
+    auto [ width, height ] = target.getSize();
+
+    sf::Transform transform;
+    transform.scale(width * 1.0f, height * 1.0f);
+
+    sf::Clock clock;
+
+    for (int frame = 0; frame < frames; ++frame) {
+        target.clear(sf::Color::White);
+        draw(renderer, target, transform);
+        target.display();
+    }
+
+    return clock.getElapsedTime().asSeconds() * 1000.0 / frames;
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/render.cpp src/*.cpp src/utils/*.cpp 
+        -lsfml-system -lsfml-window -lsfml-graphics  
+    */
+
+    sf::RenderTexture target;
+    if (!target.create(900, 900)) {
+        std::cout << "Could not create a render texture\n";
+        return 1;
+    }
+
+    DrawFunction perMine = [](const MinefieldRenderer& renderer, sf::RenderTarget& target, sf::RenderStates states) {
+        renderer.drawMines(target, states);
+    };
+
+    DrawFunction batched = [](const MinefieldRenderer& renderer, sf::RenderTarget& target, sf::RenderStates states) {
+        renderer.drawBatched(target, states);
+    };
+
+    const std::size_t sizes[][3] = {
+        { 8, 8, 10 },
+        { 16, 16, 40 },
+        { 16, 30, 90 },
+        { 100, 100, 1500 },
+        { 300, 300, 15000 }
+    };
+
+    std::cout << "board\tper mine (ms)\tbatched (ms)\tcached, 1 change (ms)\tcached, 100 changes (ms)\n";
+
+    for (auto [ cols, rows, bombs ] : sizes) {
+        Minefield board { cols, rows, bombs };
+        board.revealAll();
+
+        MinefieldRenderer renderer { board };
+
+        // Flags some mines before every frame, and clears them after drawing
+        auto cached = [&board](std::size_t changes) {
+            return [&board, changes](const MinefieldRenderer& renderer, sf::RenderTarget& target, sf::RenderStates states) {
+                for (std::size_t i = 0; i < changes; ++i)
+                    board.flag(i % board.cols, (i / board.cols) % board.rows);
+
+                target.draw(renderer, states);
+                board.clearChanges();
+            };
+        };
+
+        const int frames = 20;
+
+        double perMineTime = timeFrames(renderer, target, perMine, frames);
+        double batchedTime = timeFrames(renderer, target, batched, frames);
+
+        // Flags can only be toggled on hidden mines, and the 
+        // first frame after the reset fills the texture
+        board.resetAll();
+        timeFrames(renderer, target, cached(0), 1);
+
+        double cachedTime = timeFrames(renderer, target, cached(1), frames);
+        double cachedManyTime = timeFrames(renderer, target, cached(100), frames);
+
+        std::cout << cols << "x" << rows << "\t" 
+                  << perMineTime << "\t" << batchedTime << "\t" 
+                  << cachedTime << "\t" << cachedManyTime << "\n";
+    }
+
+    return 0;
+}
+/////////
@@ -0,0 +1,64 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+
+#include "../headers/minefield.hpp"
+
+/**
+ * Compares generating a board with `resetAll` against saving it to a
+ * snapshot and loading it again with `Minefield::load`, which maps the
+ * file instead of reading it. Touching every mine of a loaded board
+ * (`revealAll`) shows the cost of reading the pages of the file.
+ */
+
+// Returns the time a function takes in milliseconds
+template <typename Function>
+double timeMs(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/snapshot.cpp src/mine.cpp src/minefield.cpp src/utils/mapped_file.cpp
+    */
+
+    const char * path = "bench-snapshot.bin";
+    const std::size_t sizes[] = { 1000, 4000, 10000 };
+
+    std::cout << "board\tresetAll (ms)\tsave (ms)\tload (ms)\trevealAll after load (ms)\n";
+
+    for (auto size : sizes) {
+        Minefield board { size, size, size * size / 6 };
+
+        double resetTime = timeMs([&] { board.resetAll(); });
+        double saveTime = timeMs([&] { board.save(path); });
+
+        std::size_t bombs = 0;
+
+        double loadTime = timeMs([&] {
+            auto loaded = Minefield::load(path);
+            bombs = loaded.bombs;
+        });
+
+        auto loaded = Minefield::load(path);
+        double revealTime = timeMs([&] { loaded.revealAll(); });
+
+        std::cout << size << "x" << size << "\t"
+                  << resetTime << "\t" << saveTime << "\t"
+                  << loadTime << "\t" << revealTime
+                  << "\t(" << bombs << " bombs)\n";
+    }
+
+    std::remove(path);
+
+    return 0;
+}
+/////////
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <chrono>
+
+#include "../headers/difficulty.hpp"
+#include "../headers/solver.hpp"
+
+/**
+ * Plays games with the `Solver` on every difficulty preset without a
+ * window, and reports how many moves and games it plays per second
+ * and how many of the games it wins.
+ */
+
+// Returns the time a function takes in milliseconds
+template <typename Function>
+double timeMs(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/solver.cpp src/mine.cpp src/minefield.cpp src/difficulty.cpp
+        src/player.cpp src/solver.cpp src/utils/mapped_file.cpp
+    */
+
+    const std::pair<const char *, Difficulty> boards[] = {
+        { "easy", Difficulty::EASY },
+        { "intermediate", Difficulty::INTERMIEDIATE },
+        { "expert", Difficulty::EXPERT },
+        { "expert (30x16, 99)", Difficulty(30, 16, 99) }
+    };
+
+    const int games = 20000;
+
+    std::cout << "board\tmoves/s\tgames/s\twon\tguesses per game\n";
+
+    for (const auto& [ name, difficulty ] : boards) {
+        Minefield board { difficulty.cols, difficulty.rows, difficulty.bombs };
+        board.setSeed(1);
+
+        Solver solver;
+
+        std::size_t moves = 0, won = 0;
+
+        double time = timeMs([&] {
+            for (int game = 0; game < games; ++game) {
+                auto result = solver.play(board, board.cols / 2, board.rows / 2);
+
+                moves += result.moves;
+                won += result.won;
+            }
+        });
+
+        std::cout << name << "\t"
+                  << moves * 1000.0 / time << "\t"
+                  << games * 1000.0 / time << "\t"
+                  << 100.0 * won / games << "%\t"
+                  << (double) solver.getGuesses() / games << "\n";
+    }
+
+    return 0;
+}
+/////////
@@ -0,0 +1,242 @@
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <atomic>
+#include <new>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include "../headers/difficulty.hpp"
+#include "../headers/minefield_renderer.hpp"
+
+/**
+ * Times the hot paths of a `Minefield` (`reveal`, `resetAll`,
+ * `revealAll`, `getNeighbors`) and of its `MinefieldRenderer` (`draw`)
+ * on the difficulty presets and on large boards.
+ *
+ * Every operation is run many times, and the percentiles of its latency
+ * and the allocations it makes are printed as one CSV line, so that the
+ * output of two builds can be diffed. Frames are drawn into an offscreen
+ * texture so that no window or vsync gets in the way.
+ */
+
+/**
+ * Every allocation of the program is counted, so that the
+ * allocations of a single operation can be measured.
+ */
+std::atomic<std::size_t> allocations { 0 }, allocatedBytes { 0 };
+
+void * operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (void * pointer = std::malloc(size ? size : 1))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void * pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void * pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+/**
+ * The latencies and allocations of an operation
+ */
+struct Result
+{
+    std::vector<double> samples;
+    std::size_t allocations = 0, bytes = 0;
+
+    // The sample at a percentile, picked by the nearest rank
+    double getPercentile(double percentile) const
+    {
+        std::size_t rank = static_cast<std::size_t>(percentile / 100.0 * samples.size() + 0.5);
+        return samples[std::min(std::max<std::size_t>(rank, 1), samples.size()) - 1];
+    }
+
+    double getMean() const
+    {
+        double sum = 0;
+        for (auto sample : samples)
+            sum += sample;
+
+        return sum / samples.size();
+    }
+};
+
+/**
+ * Runs an operation until it has enough samples or it has run for long
+ * enough. The setup runs before each sample and isn't measured, but it 
+ * counts towards the time budget.
+ */
+struct Runner
+{
+    std::size_t minSamples = 5, maxSamples = 1000;
+    double budgetMs = 250;
+
+    Result run(const std::function<void()>& setup, const std::function<void()>& operation) const
+    {
+        Result result;
+        double total = 0;
+
+        auto begin = std::chrono::steady_clock::now();
+
+        while (result.samples.size() < maxSamples && (result.samples.size() < minSamples || total < budgetMs)) {
+            setup();
+
+            std::size_t startAllocations = allocations.load(std::memory_order_relaxed);
+            std::size_t startBytes = allocatedBytes.load(std::memory_order_relaxed);
+
+            auto start = std::chrono::steady_clock::now();
+            operation();
+            std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+            result.allocations += allocations.load(std::memory_order_relaxed) - startAllocations;
+            result.bytes += allocatedBytes.load(std::memory_order_relaxed) - startBytes;
+
+            result.samples.push_back(elapsed.count());
+
+            std::chrono::duration<double, std::milli> wall = std::chrono::steady_clock::now() - begin;
+            total = wall.count();
+        }
+
+        std::sort(result.samples.begin(), result.samples.end());
+        return result;
+    }
+};
+
+// Prints a result as a line of CSV
+void report(const char * name, const Difficulty& difficulty, const char * operation, const Result& result)
+{
+    auto count = result.samples.size();
+
+    std::cout << name << "," << difficulty.cols << "," << difficulty.rows << "," << difficulty.bombs << ","
+              << operation << "," << count << ","
+              << result.getMean() << ","
+              << result.getPercentile(50) << ","
+              << result.getPercentile(90) << ","
+              << result.getPercentile(99) << ","
+              << result.samples.back() << ","
+              << static_cast<double>(result.allocations) / count << ","
+              << static_cast<double>(result.bytes) / count << "\n";
+}
+
+// Prevents the compiler from throwing away a result
+volatile long long sink;
+
+/////////
+int main(int argc, char ** argv)
+{
+
+    /*
+    g++ -O2 -std=c++17 bench/suite.cpp src/*.cpp src/utils/*.cpp
+        -lsfml-system -lsfml-window -lsfml-graphics
+
+    ./a.out [--no-draw] [--samples <max>] [--budget <ms>] > before.csv
+    */
+
+    Runner runner;
+    bool drawing = true;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--no-draw") == 0)
+            drawing = false;
+        else if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+            runner.maxSamples = std::stoul(argv[++i]);
+        else if (std::strcmp(argv[i], "--budget") == 0 && i + 1 < argc)
+            runner.budgetMs = std::stod(argv[++i]);
+    }
+
+    sf::RenderTexture target;
+    if (drawing && !target.create(900, 900)) {
+        std::cerr << "Could not create a render texture, skipping draw\n";
+        drawing = false;
+    }
+
+    sf::Transform transform;
+    transform.scale(900.0f, 900.0f);
+
+    const std::pair<const char *, Difficulty> boards[] = {
+        { "easy", Difficulty::EASY },
+        { "intermediate", Difficulty::INTERMIEDIATE },
+        { "expert", Difficulty::EXPERT },
+        { "large", Difficulty(256, 256, 256 * 256 / 6) },
+        { "huge", Difficulty(1000, 1000, 1000 * 1000 / 6) },
+        { "giant", Difficulty(4000, 4000, 4000 * 4000 / 6) }
+    };
+
+    // The most mines the game puts on the screen in each direction
+    const float MAX_VIEW = 200;
+
+    std::cout << "board,cols,rows,bombs,operation,samples,mean_us,p50_us,p90_us,p99_us,max_us,allocs_per_op,bytes_per_op\n";
+
+    for (const auto& [ name, difficulty ] : boards) {
+        std::cerr << "Running " << name << "\n";
+
+        Minefield board { difficulty.cols, difficulty.rows, difficulty.bombs };
+        board.setSeed(1);
+
+        int x = static_cast<int>(board.cols / 2),
+            y = static_cast<int>(board.rows / 2);
+
+        auto nothing = [] {};
+        auto reset = [&] { board.resetAll(x, y); };
+
+        report(name, difficulty, "resetAll", runner.run(nothing, [&] { board.resetAll(); }));
+        report(name, difficulty, "resetAll(x,y)", runner.run(nothing, reset));
+        report(name, difficulty, "reveal", runner.run(reset, [&] { board.reveal(x, y); }));
+        report(name, difficulty, "revealAll", runner.run(reset, [&] { board.revealAll(); }));
+
+        report(name, difficulty, "getNeighbors", runner.run(nothing, [&] {
+            long long sum = 0;
+
+            for (std::size_t j = 0; j < board.rows; ++j) {
+                for (std::size_t i = 0; i < board.cols; ++i)
+                    sum += board.getNeighbors(i, j);
+            }
+
+            sink = sum;
+        }));
+
+        if (!drawing)
+            continue;
+
+        MinefieldRenderer renderer { board };
+        renderer.setView({ 0, 0, std::min<float>(board.cols, MAX_VIEW), std::min<float>(board.rows, MAX_VIEW) });
+
+        auto frame = [&] {
+            target.clear(sf::Color::White);
+            target.draw(renderer, transform);
+            target.display();
+
+            board.clearChanges();
+        };
+
+        // A reset changes every mine, so the whole view is drawn again
+        report(name, difficulty, "draw(full)", runner.run(reset, frame));
+
+        // Flags can only be toggled on hidden mines, so the board is
+        // reset once and the first frame fills the texture
+        board.resetAll();
+        frame();
+
+        report(name, difficulty, "draw(1 change)", runner.run([&] { board.flag(0, 0); }, frame));
+        report(name, difficulty, "draw(unchanged)", runner.run(nothing, frame));
+    }
+
+    return 0;
+}
+/////////
@@ -0,0 +1,92 @@
+#ifndef __ANALYTICS_HPP__
+#define __ANALYTICS_HPP__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "./minefield.hpp"
+
+/**
+ * Rates how hard a board is from where its bombs are, before it is
+ * played. An opening opens with one click, and so does every number
+ * that isn't next to an opening, which is isolated. Together they are
+ * the fewest clicks that win the board without flags, its 3BV.
+ *
+ * A board is analyzed in a single pass over its rows. The runs of mines
+ * with no neighboring bombs along each row are joined with union-find to
+ * the runs they touch in the row above, so the openings are the runs
+ * minus the joins. The buffers are kept between boards, so analyzing
+ * many boards of the same size doesn't allocate.
+ */
+class Analytics
+{
+
+public:
+
+    struct Metrics
+    {
+        std::size_t bbbv = 0, openings = 0, isolated = 0;
+    };
+
+    /**
+     * The number of boards of a size with each value of each metric. The
+     * counts only go up to the largest value that a board had, which is
+     * far below the size of the board.
+     */
+    struct Histograms
+    {
+        std::size_t cols, rows, bombs, boards = 0;
+        std::vector<std::uint64_t> bbbv, openings, isolated;
+
+        Histograms(std::size_t cols, std::size_t rows, std::size_t bombs);
+
+        void add(const Metrics& metrics);
+        void add(const Histograms& histograms);
+    };
+
+private:
+
+    /**
+     * What each mine of the rows above, at and below the row being
+     * analyzed is, with an empty cell on both sides
+     */
+    static constexpr unsigned char OPENING = 1, NUMBER = 2;
+
+    std::vector<unsigned char> above, row, below;
+
+    /**
+     * The runs of the row above and of the row being analyzed, and the 
+     * run that each run of the board was joined to
+     */
+    struct Run
+    {
+        std::uint32_t first, last, id;
+    };
+
+    std::vector<Run> aboveRuns, runs;
+    std::vector<std::uint32_t> parents;
+
+    void readRow(const Minefield& board, std::size_t y, std::vector<unsigned char>& kinds) const;
+
+    std::uint32_t find(std::uint32_t run);
+
+public:
+
+    /**
+     * Works out the metrics of the bombs of a board. The mines that were
+     * opened or flagged don't change them.
+     */
+    Metrics analyze(const Minefield& board);
+
+    /**
+     * Writes histograms to a binary file: a header, then for each board
+     * size and metric, the size, the metric and the counts from the first
+     * to the last value that any board had. Throws if the file can't be
+     * written.
+     */
+    static void save(const std::string& path, const std::vector<Histograms>& histograms);
+
+};
+
+#endif
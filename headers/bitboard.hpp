@@ -0,0 +1,191 @@
+#ifndef __BITBOARD_HPP__
+#define __BITBOARD_HPP__
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "./utils/random_engine.hpp"
+
+/**
+ * A minefield that keeps its bombs, revealed mines and flags as 
+ * packed bitsets, one bit per mine, instead of a vector of `Mine`.
+ * 
+ * It has the same gameplay functions as `Minefield`, so code that is
+ * written against them (e.g. a template) can use either board. It has 
+ * no rendering, and is meant for simulating many games at once.
+ */
+class Bitboard
+{
+
+    using Word = std::uint64_t;
+
+    /**
+     * Each row of the board starts on a new word, so that the rows 
+     * above and below a word are always at the same offset.
+     */
+    std::size_t words;
+
+    /**
+     * The bits of the last word of a row that are inside of the board
+     */
+    Word lastMask;
+
+    /**
+     * Bitsets of the whole board, indexed by `row * words + word`
+     */
+    std::vector<Word> bombMask, revealed, flags;
+
+    /**
+     * The neighbor count of every mine, split into four bitsets that 
+     * hold one bit of the count each, and a bitset of the mines that
+     * aren't bombs and have no neighboring bombs.
+     */
+    std::array<std::vector<Word>, 4> counts;
+    std::vector<Word> zeros;
+
+    /**
+     * Rows that have newly opened mines that still have to spread
+     * the reveal, kept between reveals so that their memory can be reused.
+     */
+    std::vector<std::size_t> frontier;
+    std::vector<bool> queued;
+
+    /**
+     * A row of words each for the zeros that were filled, the mines they
+     * spread to and the zeros they can fill, rewritten for every row of
+     * a reveal
+     */
+    std::vector<Word> filled, spread, fillable;
+
+    /**
+     * The mines that the reveal being made has opened, which are the 
+     * only ones that spread it. It is empty between reveals.
+     */
+    std::vector<Word> fresh;
+
+    /**
+     * The seed of the bombs on the board, and the seed that the 
+     * next reset will use
+     */
+    std::uint64_t seed = 0, nextSeed = Random::getSeed();
+
+    /**
+     * Places the bombs with Floyd's sampling algorithm, using the 
+     * bitset of bombs as the set of sampled mines. The mines at the 
+     * indices in `safe`, which has to be sorted, never get a bomb.
+     */
+    void placeBombs(const std::vector<std::size_t>& safe);
+
+    /**
+     * Counts the neighbors of 64 mines at a time by adding the eight 
+     * shifted rows around them with bitwise adders.
+     */
+    void countNeighbors();
+
+    /**
+     * Helpers to index the bitsets
+     */
+    inline std::size_t getWord(int x, int y) const;
+    inline Word getBit(int x) const;
+
+public:
+
+    // Board functions
+
+    /**
+     * Information about the size of the minefield and the 
+     * number of bombs.
+     */
+    const std::size_t cols, rows, bombs;
+
+    /**
+     * Creates a bitboard at a certain size and with a certain
+     * number of bombs.
+     */
+    Bitboard(std::size_t cols, std::size_t rows, std::size_t bombs);
+
+    /**
+     * The seed that placed the bombs of the current board, and a setter
+     * for the seed of the next reset.
+     * 
+     * Each reset picks the seed of the one after it, so a session of 
+     * boards can be replayed from the first seed. A board that was reset
+     * around a first click also needs the same first click.
+     */
+    std::uint64_t getSeed() const;
+    void setSeed(std::uint64_t seed);
+
+    /**
+     * Check if a grid x- and y- coordinate are in bounds
+     */
+    bool inBounds(int x, int y) const;
+
+    /**
+     * Getters for the state of a mine, the same as the 
+     * members of a `Mine`
+     */
+    bool bomb(int x, int y) const;
+    bool discovered(int x, int y) const;
+    bool flagged(int x, int y) const;
+
+    /**
+     * Gets the number of bombs surrounding a grid position
+     * given its x- and y- position
+     */
+    int getNeighbors(int x, int y) const;
+
+    /**
+     * The number of bytes that the board has allocated for its bitsets
+     * and for the buffers it keeps between reveals
+     */
+    std::size_t getMemoryUsage() const;
+
+    // Gameplay functions
+
+    /**
+     * Reveals a mine at a grid position. If the mine was a bomb, 
+     * returns true. Just like `Minefield::reveal`.
+     */
+    bool reveal(int x, int y);
+
+    /**
+     * Does the work of `reveal`, but returns how many mines were 
+     * opened instead.
+     * 
+     * The reveal spreads a row at a time. The zeros of a row are filled
+     * through in a few word-wide steps, and then opened together with 
+     * their neighbors in the rows around it.
+     */
+    std::size_t open(int x, int y);
+
+    /**
+     * Reveals all mines.
+     */
+    void revealAll();
+
+    /**
+     * Resets all mines and reassigns mines.
+     */
+    void resetAll();
+
+    /**
+     * Resets all mines and reassigns mines, keeping a grid position and 
+     * its neighbors free of bombs, just like `Minefield::resetAll`.
+     */
+    void resetAll(int x, int y);
+
+    /**
+     * Toggles a flag on a grid location. Returns true if the mine
+     * was already discovered, meaning it can't be flagged.
+     */ 
+    bool flag(int x, int y);
+
+    /**
+     * Returns true if every mine that isn't a bomb is revealed
+     */
+    bool won() const;
+
+};
+
+#endif
\ No newline at end of file
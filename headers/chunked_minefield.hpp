@@ -0,0 +1,195 @@
+#ifndef __CHUNKED_MINEFIELD_HPP__
+#define __CHUNKED_MINEFIELD_HPP__
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "./utils/random_engine.hpp"
+
+/**
+ * A minefield without edges, split into square chunks that are only 
+ * allocated when a mine in them is first opened or flagged.
+ * 
+ * The bombs of a chunk are derived from the seed of the board and the 
+ * coordinates of the chunk, so untouched chunks cost nothing and a chunk
+ * that was evicted is rebuilt with exactly the same bombs. Reveals, flags 
+ * and the flood fill work across the borders of chunks.
+ */
+class ChunkedMinefield
+{
+
+public:
+
+    using Coord = std::int64_t;
+
+    /**
+     * The width and height of a chunk. Each row of a chunk is a 
+     * single word of bits.
+     */
+    static constexpr int CHUNK = 64;
+    static constexpr std::size_t CHUNK_CELLS = CHUNK * CHUNK;
+
+private:
+
+    using Row = std::uint64_t;
+    using Rows = std::array<Row, CHUNK>;
+
+    struct Chunk 
+    {
+        Rows bombs, revealed, flags;
+        std::array<unsigned char, CHUNK_CELLS> neighbors;
+    };
+
+    /**
+     * Chunks are looked up by both of their coordinates, so that chunks
+     * that are 2^32 chunks apart don't share a key
+     */
+    using Key = std::pair<Coord, Coord>;
+
+    struct KeyHash
+    {
+        inline std::size_t operator()(const Key& key) const;
+    };
+
+    std::unordered_map<Key, std::unique_ptr<Chunk>, KeyHash> chunks;
+
+    /**
+     * The last chunk that was loaded, since neighboring mines are
+     * nearly always in the same chunk
+     */
+    mutable Key lastKey {};
+    mutable Chunk* lastChunk = nullptr;
+
+    /**
+     * The seed of the bombs on the board, and the seed that the 
+     * next reset will use
+     */
+    std::uint64_t seed = 0, nextSeed = Random::getSeed();
+
+    /**
+     * A position whose neighborhood is kept free of bombs, 
+     * if the board was reset around a first click
+     */
+    bool hasSafe = false;
+    Coord safeX = 0, safeY = 0;
+
+    /**
+     * Mines that still have to spread the reveal to their neighbors
+     */
+    std::vector<std::pair<Coord, Coord>> frontier;
+
+    /**
+     * Helpers for the coordinates of chunks
+     */
+    static inline Coord getChunk(Coord position);
+    static inline Key getKey(Coord cx, Coord cy);
+
+    /**
+     * Places the bombs of a chunk from the seed and its coordinates. 
+     * The same chunk always gets the same bombs.
+     */
+    Rows generate(Coord cx, Coord cy) const;
+
+    /**
+     * The bombs of the chunk at chunk coordinates, from the chunk if it 
+     * is allocated, and generated otherwise
+     */
+    Rows getBombs(Coord cx, Coord cy) const;
+
+    /**
+     * Returns the chunk at chunk coordinates, generating it if it 
+     * isn't allocated yet.
+     */
+    Chunk& load(Coord cx, Coord cy);
+
+    /**
+     * Returns the chunk at chunk coordinates, or null if it 
+     * isn't allocated.
+     */
+    const Chunk* find(Coord cx, Coord cy) const;
+
+public:
+
+    // Board functions
+
+    /**
+     * The number of bombs in every chunk. It is at least an eighth of 
+     * the chunk, because below a density of about a tenth the zeros 
+     * connect into openings without an end.
+     */
+    const std::size_t bombsPerChunk;
+
+    /**
+     * Creates an endless minefield with a certain number 
+     * of bombs in every chunk
+     */
+    ChunkedMinefield(std::size_t bombsPerChunk);
+
+    /**
+     * The seed that placed the bombs of the current board, and a setter
+     * for the seed of the next reset, just like `Minefield`.
+     */
+    std::uint64_t getSeed() const;
+    void setSeed(std::uint64_t seed);
+
+    /**
+     * Getters for the state of a mine. Mines in chunks that aren't 
+     * allocated are hidden, and their bombs are generated to answer, 
+     * each chunk at most once per call.
+     */
+    bool bomb(Coord x, Coord y) const;
+    bool discovered(Coord x, Coord y) const;
+    bool flagged(Coord x, Coord y) const;
+    int getNeighbors(Coord x, Coord y) const;
+
+    // Gameplay functions
+
+    /**
+     * Reveals a mine at a grid position. If the mine was a bomb, 
+     * returns true. Just like `Minefield::reveal`.
+     */
+    bool reveal(Coord x, Coord y);
+
+    /**
+     * Does the work of `reveal`, but returns how many mines were 
+     * opened instead. Chunks are allocated as the opening reaches them.
+     */
+    std::size_t open(Coord x, Coord y);
+
+    /**
+     * Drops every chunk and picks new bombs from the next seed.
+     */
+    void resetAll();
+
+    /**
+     * Drops every chunk and picks new bombs from the next seed, keeping 
+     * a grid position and its neighbors free of bombs.
+     */
+    void resetAll(Coord x, Coord y);
+
+    /**
+     * Toggles a flag on a grid location. Returns true if the mine
+     * was already discovered, meaning it can't be flagged.
+     */ 
+    bool flag(Coord x, Coord y);
+
+    // Memory functions
+
+    /**
+     * Returns the number of allocated chunks
+     */
+    std::size_t getChunkCount() const;
+
+    /**
+     * Frees every chunk that has no opened or flagged mines, since it
+     * can be rebuilt exactly. Returns the number of freed chunks.
+     */
+    std::size_t evictUntouched();
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef __DIFFICULTY_HPP__
+#define __DIFFICULTY_HPP__
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * This struct describes how to create a 
+ * minefield game board.
+ */
+struct Difficulty
+{
+
+    const std::size_t cols, rows, bombs;
+
+    Difficulty(std::size_t cols, std::size_t rows, std::size_t bombs);
+
+    const static Difficulty EASY;
+    const static Difficulty INTERMIEDIATE;
+    const static Difficulty EXPERT;
+
+    const static Difficulty DEFAULT;
+
+    /**
+     * Parses a list of presets (`easy`, `intermediate`, `expert`) and of
+     * custom sizes as `<cols> <rows> <bombs>`, and names each of them.
+     * Throws if a word is neither.
+     */
+    static std::vector<std::pair<std::string, Difficulty>> parse(const std::vector<std::string>& words);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+#ifndef __GENERATOR_HPP__
+#define __GENERATOR_HPP__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "./minefield.hpp"
+#include "./solver.hpp"
+#include "./utils/thread_pool.hpp"
+
+/**
+ * Finds boards that can be solved from the first click without guessing.
+ *
+ * A board is a seed, so the generator looks for a seed whose board, reset
+ * around the first click, is won by a `Solver` that never guesses. The
+ * candidates are numbered seeds from a starting seed, and every thread
+ * of a `ThreadPool` plays candidates on its own board. A candidate is
+ * rejected as soon as the solver is stuck, and the threads stop once a
+ * candidate before theirs was solved.
+ *
+ * The first candidate that is solved is always the one that is used,
+ * however many threads there are, so a session is still replayed from
+ * its seed. A search plays at most a budget of candidates, and if none
+ * of them is solved, it uses the one that the solver got furthest on,
+ * which needs the fewest guesses. A search can be started ahead of the click that needs it,
+ * so that a game doesn't have to wait for it.
+ */
+class Generator
+{
+
+    const std::size_t cols, rows, bombs;
+
+    /**
+     * A search for a board around a first click, from a starting seed
+     */
+    struct Search
+    {
+        const int x, y;
+        const std::uint64_t seed;
+
+        // The next candidate to play, and the first one that was solved
+        std::atomic<std::uint64_t> next { 0 }, solved;
+        std::atomic<bool> cancelled { false };
+
+        /**
+         * The candidate that left the fewest safe mines hidden when the
+         * solver was stuck, as those mines in the high half and the
+         * candidate in the low half, so that the lowest is the best and
+         * ties go to the first candidate
+         */
+        std::atomic<std::uint64_t> best { ~std::uint64_t(0) };
+
+        // The tasks of the search that are still running
+        std::size_t running = 0;
+        std::mutex mutex;
+        std::condition_variable finished;
+
+        Search(int x, int y, std::uint64_t seed, std::uint64_t budget);
+    };
+
+    /**
+     * The number of candidates that a search plays before it gives up
+     */
+    const std::uint64_t budget;
+
+    /**
+     * The search that was started ahead of time, if there is one
+     */
+    std::shared_ptr<Search> prepared;
+
+    /**
+     * The board and the solver of each thread, which are reused
+     */
+    std::vector<std::unique_ptr<Minefield>> boards;
+    std::vector<std::unique_ptr<Solver>> solvers;
+
+    std::atomic<std::uint64_t> candidates { 0 };
+
+    // Declared last, so the threads stop before the boards are freed
+    ThreadPool pool;
+
+    std::shared_ptr<Search> begin(int x, int y, std::uint64_t seed);
+
+    // Plays the candidates of a search on a thread until it is over
+    void run(Search& search, std::size_t thread);
+
+public:
+
+    /**
+     * A search plays candidates until it has played this many mines, so
+     * a search on a larger board plays fewer candidates, but always at
+     * least `MIN_CANDIDATES` and at most `MAX_CANDIDATES`. A candidate
+     * costs about the same per mine whatever the density, so the wait for
+     * a board that can't be found is bounded, and on dense boards, where
+     * hardly any candidate is solved, a search gives up in about that time.
+     */
+    static constexpr std::uint64_t MAX_MINES = 1 << 20;
+    static constexpr std::uint64_t MIN_CANDIDATES = 64, MAX_CANDIDATES = 1 << 16;
+
+    /**
+     * Creates a generator for boards of a size, which plays candidates on
+     * a number of threads
+     */
+    Generator(
+        std::size_t cols, std::size_t rows, std::size_t bombs,
+        std::size_t threads = std::thread::hardware_concurrency()
+    );
+
+    /**
+     * Cancels the searches that are running
+     */
+    ~Generator();
+
+    /**
+     * The seed of a candidate of a search
+     */
+    static std::uint64_t getCandidate(std::uint64_t seed, std::uint64_t candidate);
+
+    /**
+     * Returns the seed of a board that can be solved without guessing
+     * from a first click at a grid position. The board is made by setting
+     * the seed of a `Minefield` and resetting it around the first click.
+     *
+     * It uses the search that was prepared if it is for the same click
+     * and starting seed, and otherwise searches and waits.
+     */
+    std::uint64_t find(int x, int y, std::uint64_t seed);
+
+    /**
+     * Starts searching for the board of a later `find` in the background.
+     * A search that was prepared before and not used is cancelled.
+     */
+    void prepare(int x, int y, std::uint64_t seed);
+
+    /**
+     * The number of candidates that were played since the generator was
+     * created, including those of cancelled searches
+     */
+    std::uint64_t getCandidates() const;
+
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef __JOURNAL_HPP__
+#define __JOURNAL_HPP__
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "./minefield.hpp"
+#include "./move.hpp"
+#include "./utils/mapped_file.hpp"
+
+/**
+ * Records the moves of a session into a binary file, which is only
+ * ever appended to. The file starts with a header with the size of
+ * the board, followed by the moves as they are in memory.
+ */
+class Journal
+{
+
+    std::ofstream file;
+    std::chrono::steady_clock::time_point opened;
+
+public:
+
+    /**
+     * Creates a journal for boards of a size, replacing the file
+     * if it already exists. Throws if the file can't be written.
+     */
+    Journal(const std::string& path, std::size_t cols, std::size_t rows, std::size_t bombs);
+
+    /**
+     * Appends a move to the journal. It should be recorded after it
+     * was played on the board, and is written out right away so that
+     * a crash only loses the move being recorded.
+     */
+    void record(Move::Action action, int x, int y, std::uint64_t seed);
+
+};
+
+/**
+ * Plays the moves of a journal again on a board without a window, as
+ * quickly as they can be played. The journal is mapped into memory, so
+ * the moves are read in place.
+ */
+class Replay
+{
+
+    MappedFile mapping;
+    std::size_t count;
+
+public:
+
+    /**
+     * The board the journal was recorded on
+     */
+    std::size_t cols, rows, bombs;
+
+    /**
+     * The outcome of a game in the journal, which can be compared
+     * with the score of the player
+     */
+    struct Game
+    {
+        std::uint64_t seed = 0;
+        std::uint32_t start = 0, end = 0;
+        std::size_t clicks = 0, opened = 0;
+        bool won = false, lost = false;
+    };
+
+    /**
+     * Loads a journal, and throws if it isn't a journal of this version.
+     * A move that was cut off at the end of the file is ignored.
+     */
+    Replay(const std::string& path);
+
+    std::size_t getMoveCount() const;
+    Move getMove(std::size_t index) const;
+
+    /**
+     * Plays every move on a board with the size of the journal, with
+     * the same rules as the game, and returns every game that was
+     * started. Throws if a move was played on a different board than
+     * the one it was recorded on.
+     */
+    std::vector<Game> play(Minefield& board) const;
+
+};
+
+#endif
\ No newline at end of file
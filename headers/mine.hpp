@@ -1,11 +1,16 @@
 #ifndef __MINE_HPP__
 #define __MINE_HPP__
 
-#include <SFML/Graphics/Drawable.hpp>
-#include <string>
-#include <SFML/Graphics/Color.hpp>
-
-struct Mine : public sf::Drawable
+#include <cstdint>
+
+/**
+ * The game information of a single mine. It has no rendering, 
+ * which is done by a `MineRenderer`.
+ * 
+ * All of the information is packed into bit fields of a single byte, 
+ * so a board is a flat array of bytes.
+ */
+struct Mine
 {
     // Game information
 
@@ -15,52 +20,41 @@ struct Mine : public sf::Drawable
      * All of these are mutually exclusive, so they 
      * are in an enum for convenience.
      */
-    enum State {
+    enum State : std::uint8_t {
         Default,
         Discovered,
         Flagged
     };
-    State state = State::Default;
 
     /**
-     * These are convenience methods to interpret 
-     * which state the mine is.
+     * The number of neighboring bombs, which is never more than 8
      */
-    bool discovered() const;
-    bool flagged() const;
+    std::uint8_t neighbors : 4;
 
     /**
      * A mine can have any state and be a bomb.
      */
-    bool bomb;
+    std::uint8_t bomb : 1;
 
-    unsigned int neighbors;
+    std::uint8_t state : 2;
 
-    /**
-     * Resets the state of a mine 
-     * entirely
-     */
-    void reset();
+    Mine();
 
-public:
-    // Render information
-    
     /**
-     * Draws the mine as a rectangle with text somewhere on the board. 
-     * 
-     * The transform in the render states is provided by a `Minefield`
-     * and will be scaled and then translated by the `Minefield` to fit.
+     * These are convenience methods to interpret 
+     * which state the mine is.
      */
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const;
-
-private:
+    bool discovered() const;
+    bool flagged() const;
 
     /**
-     * Helper method to decide what text to put and what color it should
-     * be when drawing the mine.
+     * Resets the state of a mine 
+     * entirely
      */
-    inline std::pair<std::string, sf::Color> getInfo() const;
+    void reset();
 
 };
 
+static_assert(sizeof(Mine) == 1, "A mine should be packed into one byte");
+
 #endif
\ No newline at end of file
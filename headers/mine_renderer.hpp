@@ -0,0 +1,75 @@
+#ifndef __MINE_RENDERER_HPP__
+#define __MINE_RENDERER_HPP__
+
+#include "./mine.hpp"
+#include "./utils/glyph_atlas.hpp"
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+/**
+ * Draws a `Mine` with SFML. The mine itself only holds game
+ * information, so it is wrapped in a renderer to be drawn.
+ */
+class MineRenderer : public sf::Drawable
+{
+    const Mine& mine;
+
+public:
+
+    /**
+     * Creates a renderer for a mine, which has to outlive it
+     */
+    MineRenderer(const Mine& mine);
+
+    /**
+     * Draws the mine as a rectangle with text somewhere on the board. 
+     * 
+     * The transform in the render states is provided by a `MinefieldRenderer`
+     * and will be scaled and then translated by the `MinefieldRenderer` to fit.
+     */
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+    /**
+     * Appends the rectangle of the mine (outline first, then fill) to a
+     * vertex array of triangles, so a whole board can be drawn in one call.
+     * The outline is inside of the rectangle, so nothing is drawn outside
+     * of the mine.
+     * 
+     * The transform maps the mine's unit square onto the target, just like 
+     * the transform `draw` receives in its render states.
+     */
+    void appendShape(sf::VertexArray& vertices, const sf::Transform& transform) const;
+
+    /**
+     * Draws only the text of the mine, if it has any.
+     */
+    void drawText(sf::RenderTarget& target, sf::RenderStates states) const;
+
+    /**
+     * Appends the text of the mine, if it has any, as a textured rectangle 
+     * to a vertex array of triangles. The texture coordinates point into 
+     * the atlas, which has to be used as the texture when drawing.
+     */
+    void appendText(sf::VertexArray& vertices, const sf::Transform& transform, const GlyphAtlas::Atlas& atlas) const;
+
+private:
+
+    /**
+     * Helper methods to decide how the rectangle of the mine 
+     * should be outlined.
+     */
+    inline sf::Color getOutlineColor() const;
+    inline float getOutlineThickness() const;
+
+    /**
+     * Helper method to decide what text to put and what color it should
+     * be when drawing the mine. The text is a single character, or '\0'
+     * if nothing should be written on the mine.
+     */
+    inline std::pair<char, sf::Color> getInfo() const;
+
+};
+
+#endif
\ No newline at end of file
@@ -2,29 +2,192 @@
 #define __MINEFIELD_HPP__
 
 #include "./mine.hpp"
-#include <SFML/Graphics/Drawable.hpp>
+#include "./utils/random_engine.hpp"
+#include "./utils/mapped_file.hpp"
+#include <string>
+#include <vector>
 
-class Minefield : public sf::Drawable 
+/**
+ * The rules of the game on a grid of mines. It has no rendering, 
+ * which is done by a `MinefieldRenderer`, so it can be used without
+ * SFML or a display.
+ */
+class Minefield
 {
 
     /**
      * A collection of mines that represents a grid
      * 
-     * It will often be indexed by an x- and y- coordinate
+     * It will often be indexed by an x- and y- coordinate. The mines 
+     * are either in `storage`, or in a snapshot file in `mapping`.
      */
-    std::vector<Mine> mines;
+    Mine* mines;
+    std::vector<Mine> storage;
+    MappedFile mapping;
 
     /**
-     * Moves around the bombs inside the minefield. There should
-     * already exist the right amount of bombs.
+     * The seed of the bombs on the board, and the seed that the 
+     * next reset will use
      */
-    void shuffleMines();
+    std::uint64_t seed = 0, nextSeed = Random::getSeed();
 
     /**
-     * Ensures that there are bomb number of bombs inside 
-     * the mine vector
+     * The epoch of each mine, and of the board. A reset starts a new
+     * epoch instead of clearing every mine, and the state of a mine from 
+     * an older epoch is cleared the next time it is used, so a reset 
+     * only costs the mines that were used since. The epochs wrap around
+     * after 255 resets, which clears every mine once.
+     * 
+     * A board has no epochs until its first reset.
+     */
+    mutable std::vector<std::uint8_t> epochs;
+    std::uint8_t epoch = 0;
+
+    // Clears the state of a mine from an older epoch
+    void refresh(std::size_t index) const;
+
+    /**
+     * The indices of the bombs, so that a reset only has to take 
+     * those bombs away again
+     */
+    std::vector<std::size_t> placed;
+
+    /**
+     * Below one bomb in this many mines, the counts are changed around
+     * each bomb that is taken away or placed, instead of counting the 
+     * whole board again
+     */
+    static constexpr std::size_t SPARSE = 16;
+
+    /**
+     * Clears the states and bombs of the last board, and takes its bombs
+     * out of the counts if `sparse`. A board without epochs is cleared 
+     * in full, since it doesn't know where its bombs are.
+     */
+    void clear(bool sparse);
+
+    /**
+     * Clears the last board and places new bombs, keeping the mines in
+     * `safe`, which has to be sorted, free of bombs
+     */
+    void reset(const std::vector<std::size_t>& safe);
+
+    /**
+     * Places bomb number of bombs on mines that have no bombs yet, 
+     * picking them with Floyd's sampling in O(bombs). The mines at the 
+     * indices in `safe`, which has to be sorted, never get a bomb.
+     */
+    void placeBombs(const std::vector<std::size_t>& safe);
+
+    // Adds to the counts of the neighbors of a mine
+    void countAround(std::size_t index, int delta);
+
+    /**
+     * Counts the neighboring bombs of every mine at once and stores
+     * them in the mines.
+     * 
+     * The bombs are copied into a grid padded with a border of empty 
+     * cells, so the 3x3 sum has no bounds checks or branches. It is 
+     * split into a horizontal and a vertical pass over rows of bytes.
+     */
+    void countNeighbors();
+
+    /**
+     * The mines where the runs of an opening start, which still have to
+     * be opened and spread from. It is kept between reveals so that its 
+     * memory can be reused.
+     */
+    std::vector<std::size_t> frontier;
+
+    /**
+     * Opens the opening around a hidden mine with no neighboring bombs, 
+     * a run at a time: the run of such mines along its row, and then the
+     * mines next to the run and in the rows above and below it. Those in
+     * the rows above and below that have no neighboring bombs either 
+     * start the runs that are opened next. Returns how many mines opened.
+     */
+    std::size_t openRuns(std::size_t index);
+
+    /**
+     * The openings of the board: groups of touching mines with no
+     * neighboring bombs, which open together with the mines around them.
+     *
+     * Those mines are found as runs along each row, in the order of the
+     * rows, and the runs of row y are from `rowRuns[y]` to `rowRuns[y + 1]`.
+     * Each run has the label of its opening, and the runs of an opening
+     * are in `byOpening` from `openings[label]` to `openings[label + 1]`.
+     * The mines around an opening, each once, are in `borders` from
+     * `openingBorders[label]` to `openingBorders[label + 1]`, and
+     * `zerosIn[label]` is the number of mines in its runs.
+     *
+     * The openings are labeled the first time one is opened after a
+     * reset, so that a reset doesn't cost the size of the board.
+     */
+    struct Run
+    {
+        std::uint32_t y, first, last;
+    };
+
+    static constexpr std::uint32_t NO_LABEL = 0xffffffff;
+
+    std::vector<Run> runs;
+    std::vector<std::size_t> rowRuns, openings, openingBorders;
+    std::vector<std::uint32_t> labels, byOpening, borders, zerosIn;
+    bool labeled = false;
+
+    /**
+     * An opening is only opened from its labels while all of its runs
+     * are hidden and have no flags, since a flag or an opened mine stops
+     * it from spreading. The flags on the runs of each opening are
+     * counted, and an opening is touched once any of its runs opened.
+     */
+    std::vector<std::uint32_t> flagsIn;
+    std::vector<bool> touched;
+
+    /**
+     * Finds the runs of the board in one pass, labels them with
+     * union-find by joining each run with the runs of the row above
+     * that it touches, and collects the mines around each opening
+     */
+    void labelOpenings();
+
+    // The label of the opening of a mine, or `NO_LABEL` if it isn't in a run
+    std::uint32_t getLabel(std::size_t index) const;
+
+    /**
+     * Opens every mine of an opening that is untouched and has no flags:
+     * its runs are written as whole spans of opened mines, and only the
+     * mines around it are checked one by one
+     */
+    std::size_t openOpening(std::uint32_t label);
+
+    /**
+     * Indices of the mines that changed since the changes were last
+     * cleared. Once too many mines changed, the whole board is marked 
+     * as changed instead.
      */
-    void setMines();
+    std::vector<std::size_t> changes;
+    bool changedAll = true;
+
+    void markChanged(std::size_t index);
+    void markChanged(std::size_t first, std::size_t last);
+    void markChangedAll();
+
+    /**
+     * The safe mines that are still hidden, the flags, and the flags 
+     * that are on bombs. Every move keeps them up to date, except on a
+     * loaded board, which counts them the first time they are asked for.
+     */
+    mutable std::size_t safeLeft = 0, flags = 0, correctFlags = 0;
+    mutable bool counted = true;
+
+    void count() const;
+
+    /**
+     * Creates a minefield whose mines are in a mapped snapshot file, 
+     * starting at an offset
+     */
+    Minefield(MappedFile mapping, std::size_t offset, std::size_t cols, std::size_t rows, std::size_t bombs);
 
 public:
 
@@ -42,6 +205,25 @@ public:
      */
     Minefield(std::size_t cols, std::size_t rows, std::size_t bombs);
 
+    /**
+     * A minefield can be moved but not copied, since its mines
+     * may be in a mapped file
+     */
+    Minefield(const Minefield&) = delete;
+    Minefield(Minefield&&) = default;
+
+    /**
+     * The seed that placed the bombs of the current board, and a getter
+     * and a setter for the seed of the next reset.
+     * 
+     * Each reset picks the seed of the one after it, so a session of 
+     * boards can be replayed from the first seed. A board that was reset
+     * around a first click also needs the same first click.
+     */
+    std::uint64_t getSeed() const;
+    std::uint64_t getNextSeed() const;
+    void setSeed(std::uint64_t seed);
+
     /**
      * Check if a grid x- and y- coordinate are in bounds
      */
@@ -55,10 +237,17 @@ public:
 
     /**
      * Gets the number of bombs surrounding a grid position
-     * given its x- and y- position
+     * given its x- and y- position. These are counted ahead 
+     * of time whenever the bombs are placed.
      */
     int getNeighbors(int x, int y) const;
 
+    /**
+     * The number of bytes that the board has allocated for its mines 
+     * and for the buffers it keeps between reveals
+     */
+    std::size_t getMemoryUsage() const;
+
     // Gameplay functions
 
     /**
@@ -70,50 +259,100 @@ public:
      */
     bool reveal(int x, int y);
 
+    /**
+     * Does the work of `reveal`, but returns how many mines were 
+     * opened instead. Bombs and flagged mines are never opened.
+     * 
+     * An opening without flags is opened in one step from its labels,
+     * which are found once per board, the first time one is opened. It
+     * only writes the spans of its runs and checks the mines around it,
+     * without looking at any neighbors. An opening with a flag in it, or
+     * that was partly opened, is opened a run at a time from the mine
+     * that was clicked with an explicit stack, since a flag stops an
+     * opening from spreading, and so does a mine that was already opened.
+     */
+    std::size_t open(int x, int y);
+
     /**
      * Reveals all mines. Simply sets their state to discovered.
      * 
-     * Usually used at the end of the game to show results. Doesn't 
-     * calculate neighbors.
+     * Usually used at the end of the game to show results. The counters
+     * are left as the moves of the player made them, so a board that was
+     * lost isn't won by revealing it.
      */
     void revealAll();
 
     /**
      * Resets all mines and reassigns mines.
+     * 
+     * Only the bombs and the mines that were used since the last reset
+     * are cleared, so on a sparse board it costs O(bombs) rather than
+     * the size of the board.
      */
     void resetAll();
 
+    /**
+     * Resets all mines and reassigns mines, keeping a grid position and 
+     * its neighbors free of bombs, so that a first click there is safe 
+     * after a single reset.
+     */
+    void resetAll(int x, int y);
+
     /**
      * Toggles a flag on a grid location. Returns true if the mine
      * was already discovered, meaning it can't be flagged.
      */ 
     bool flag(int x, int y);
 
-public:
+    // Counters
 
-    // Rendering functions
+    /**
+     * The mines that aren't bombs and are still hidden, the flags that 
+     * were placed, and the flags that are on bombs. These are kept up to 
+     * date by the moves of the board rather than counted, so they cost 
+     * nothing to ask for. Neither `revealAll` nor a change made to a mine
+     * from `get` is counted.
+     */
+    std::size_t getSafeLeft() const;
+    std::size_t getFlags() const;
+    std::size_t getCorrectFlags() const;
+
+    /**
+     * A game is won once every mine that isn't a bomb is opened
+     */
+    bool isWon() const;
 
-    /*************
-     * RENDERING *
-     ************/
+    // Change tracking
 
     /**
-     * Returns a transform that represents a singular mine at (0,0). Should
-     * be given the transform that represents the entire board.
+     * The indices of the mines that changed since the last call to 
+     * `clearChanges`, so that a renderer only has to draw those mines 
+     * again. If `allChanged` is true, the indices are empty and every 
+     * mine has to be drawn again.
      */
-    sf::Transform getMineTransform(const sf::Transform& transform) const;
-    
+    const std::vector<std::size_t>& getChanges() const;
+    bool allChanged() const;
+
+    void clearChanges();
+
+    // Snapshots
+
     /**
-     * Returns a transform that represents a singular mine at (0,0). Should
-     * be given two vectors (position and size) that represent the board.
+     * Writes the board to a binary file in a single pass: a header with 
+     * the size, bombs and seeds of the board, followed by the mines as
+     * they are packed in memory. Throws if the file can't be written.
      */
-    sf::Transform getMineTransform(const sf::Vector2f& top, const sf::Vector2f& size) const;
+    void save(const std::string& path) const;
 
     /**
-     * Draws all the mines to the board. Is given a transform for the entire
-     * board and calculates each mines 
+     * Loads a board that was written by `save` by mapping the file into
+     * memory. The mines are used in place, so nothing is parsed and a 
+     * board of any size opens at once. Changes to the board stay in 
+     * memory and never reach the file.
+     * 
+     * Throws if the file isn't a snapshot of this version.
      */
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+    static Minefield load(const std::string& path);
 
 };
 
@@ -0,0 +1,129 @@
+#ifndef __MINEFIELD_RENDERER_HPP__
+#define __MINEFIELD_RENDERER_HPP__
+
+#include "./minefield.hpp"
+#include "./utils/glyph_atlas.hpp"
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+/**
+ * Draws a `Minefield` with SFML. It is layered on top of the board, 
+ * which only holds the rules of the game.
+ */
+class MinefieldRenderer : public sf::Drawable
+{
+
+    const Minefield& board;
+
+    /**
+     * The part of the board that is drawn, in mines
+     */
+    sf::FloatRect view;
+
+public:
+
+    /**
+     * Creates a renderer for a board, which has to outlive it
+     */
+    MinefieldRenderer(const Minefield& board);
+
+    /**********
+     * CAMERA *
+     **********/
+
+    /**
+     * The part of the board that is drawn, in mines. It is stretched
+     * over the whole transform the renderer is drawn with, and starts 
+     * as the whole board.
+     */
+    void setView(const sf::FloatRect& view);
+    const sf::FloatRect& getView() const;
+
+    /**
+     * Returns the mines that intersect the view, clipped to the board. 
+     * Only these mines are drawn.
+     */
+    sf::IntRect getVisibleMines() const;
+
+    /*************
+     * RENDERING *
+     ************/
+
+    /**
+     * Returns a transform that represents a singular mine at (0,0). Should
+     * be given the transform that represents the entire board. The 
+     * transform includes the view, so mines outside of it end up 
+     * outside of the board.
+     */
+    sf::Transform getMineTransform(const sf::Transform& transform) const;
+    
+    /**
+     * Returns a transform that represents a singular mine at (0,0). Should
+     * be given two vectors (position and size) that represent the board.
+     */
+    sf::Transform getMineTransform(const sf::Vector2f& top, const sf::Vector2f& size) const;
+
+    /**
+     * Draws all the mines to the board. Is given a transform for the entire
+     * board and calculates each mines 
+     * 
+     * The board is kept in a texture, and only the mines that changed on 
+     * the board since it was drawn are drawn into the texture again, so a 
+     * frame costs as much as the number of changed mines. The owner of the
+     * board should clear its changes after drawing.
+     */
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+    /**
+     * Draws all the visible mines to the board without the texture. 
+     * 
+     * The rectangles of every mine are batched into a single vertex array, 
+     * and so is the text of every mine, so the board costs two draw calls.
+     */
+    void drawBatched(sf::RenderTarget& target, sf::RenderStates states) const;
+
+    /**
+     * Draws all the mines to the board by drawing each `Mine` on its own
+     * with a `MineRenderer`.
+     * 
+     * This is the old way of drawing the board, kept around so that it can 
+     * be compared against `drawBatched` and `draw`.
+     */
+    void drawMines(sf::RenderTarget& target, sf::RenderStates states) const;
+
+private:
+
+    /**
+     * Vertices of the last drawn mines, kept so that their memory 
+     * can be reused between frames
+     */
+    mutable sf::VertexArray vertices { sf::PrimitiveType::Triangles };
+    mutable sf::VertexArray labels { sf::PrimitiveType::Triangles };
+
+    /**
+     * Adds a mine to the vertices, and its text to the labels if 
+     * there is an atlas to cut it out of.
+     */
+    void batch(const sf::Transform& mineTransform, std::size_t index, const GlyphAtlas::Atlas* atlas) const;
+
+    /**
+     * Draws the batched vertices and labels and empties them
+     */
+    void flush(sf::RenderTarget& target, const GlyphAtlas::Atlas* atlas) const;
+
+    /**
+     * Returns the atlas for the size of the mines in a transform
+     */
+    const GlyphAtlas::Atlas* getAtlas(const sf::Transform& mineTransform) const;
+
+    /**
+     * The texture with the board drawn into it
+     */
+    mutable sf::RenderTexture cache;
+    mutable bool cached = false;
+    mutable sf::FloatRect cachedView;
+
+};
+
+#endif
\ No newline at end of file
@@ -2,12 +2,19 @@
 #define __MINESWEEPER_HPP__
 
 #include "minefield.hpp"
+#include "minefield_renderer.hpp"
+#include "journal.hpp"
+#include "player.hpp"
+#include "generator.hpp"
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <ctime>
+#include <memory>
 
 class Minesweeper 
 {
 private:
     Minefield board;
+    MinefieldRenderer renderer { board };
 
     /**
      * GameState data
@@ -15,6 +22,7 @@ private:
 
     enum GameState {
         LOST,
+        WON,
         PLAYING,
         RESET
     };
@@ -26,12 +34,40 @@ private:
 
     inline double getTimeSeconds() const;
 
+    /**
+     * The clock is shown in ticks of a tenth of a second, so the 
+     * window only has to be drawn again once a tick while playing.
+     */
+    static constexpr double TICK = 0.1;
+    inline long getTick() const;
+
     unsigned int clicks = 0;
 
     inline void lose();
+    inline void win();
     inline void reset();
     inline void start();
 
+    /**
+     * The journal that the moves are recorded into, if there is one
+     */
+    std::unique_ptr<Journal> journal;
+
+    void record(Move::Action action, int x = 0, int y = 0);
+
+    /**
+     * The player that makes the moves instead of the mouse, if there is one
+     */
+    std::unique_ptr<Player> player;
+
+    /**
+     * The generator of boards that can be solved without guessing, if
+     * they are turned on. The board of the next game is searched for 
+     * while a game is played, around the last first click.
+     */
+    std::unique_ptr<Generator> generator;
+    sf::Vector2i firstClick;
+
 private:
 
     /**
@@ -40,8 +76,12 @@ private:
 
     inline sf::Vector2i getMineIndex(const sf::Vector2f in) const;
 
+    void handleEvent(const sf::Event &event);
     void onClick(const sf::Event &event);
 
+    // Makes a reveal or a flag, from a click or a player
+    void play(const Move& move);
+
 private:
     sf::RenderWindow window;
 
@@ -54,11 +94,53 @@ private:
     // Board
     sf::Transform getBoardTransform() const;
     void drawBoard();
+
+    // Camera, the part of the board that is on the screen in mines. 
+    // It is never larger than MAX_VIEW mines, so huge boards draw as 
+    // quickly as small ones.
+    static constexpr float MAX_VIEW = 200, MIN_VIEW = 4;
+
+    sf::FloatRect view;
+
+    bool dragging = false;
+    sf::Vector2i dragPosition;
+
+    void zoomView(float factor, const sf::Vector2f& anchor);
+    void panView(const sf::Vector2f& mines);
+    void clampView();
     
     // Menu
     sf::Transform getMenuTransform() const;
     void drawMenu();
 
+private:
+
+    /**
+     * Frame data
+     * 
+     * A frame is only drawn when the game changed or the clock ticked, 
+     * otherwise the window waits for events instead of spinning.
+     */
+
+    bool changed = true;
+    long drawnTick = -1;
+
+    bool needsDraw() const;
+
+    /**
+     * Frame statistics, which are printed every few seconds 
+     * when they are enabled
+     */
+
+    static constexpr double STATS_PERIOD = 5.0;
+
+    bool stats = false;
+    sf::Clock statsClock;
+    std::clock_t statsCpu;
+    unsigned int frames = 0;
+
+    void reportStats();
+
 private:
 
     void handleInput();
@@ -69,13 +151,30 @@ public:
     Minesweeper(
         std::size_t width, std::size_t height, 
         std::size_t cols,  std::size_t rows,
-        std::size_t bombs
+        std::size_t bombs,
+        std::uint64_t seed = Random::getSeed()
     );
 
     // If the program shouldn't close, isPlaying is true
     bool isPlaying() const;
     void execute();
 
+    // Caps the frames drawn per second (0 is no cap) or syncs them to the display
+    void setFrameLimit(unsigned int limit);
+    void setVerticalSync(bool enabled);
+
+    // Prints the frames per second and CPU usage every few seconds
+    void setStats(bool enabled);
+
+    // Records every move into a journal at a path, which can be replayed
+    void setJournal(const std::string& path);
+
+    // Lets a player make the moves of every game instead of the mouse
+    void setPlayer(std::unique_ptr<Player> player);
+
+    // Only deals boards that can be solved from the first click without guessing
+    void setNoGuess(bool enabled);
+
 };
 
 #endif
\ No newline at end of file
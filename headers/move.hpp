@@ -0,0 +1,39 @@
+#ifndef __MOVE_HPP__
+#define __MOVE_HPP__
+
+#include <cstdint>
+
+/**
+ * A single action of the player, which is what a `Player` picks and
+ * what a `Journal` stores.
+ *
+ * A move in a journal keeps the seed of the board after it was played,
+ * so a replay can place the same bombs and notice when it went wrong.
+ * A player only fills in the action and the mine.
+ */
+struct Move
+{
+
+    enum Action : std::uint8_t {
+        Start,
+        Reveal,
+        Flag,
+        GiveUp,
+        Reset
+    };
+
+    std::uint64_t seed;
+
+    // Milliseconds since the journal was opened
+    std::uint32_t time;
+
+    std::int32_t x, y;
+
+    Action action;
+    std::uint8_t padding[3];
+
+};
+
+static_assert(sizeof(Move) == 24, "A move should have no gaps");
+
+#endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef __PLAYER_HPP__
+#define __PLAYER_HPP__
+
+#include <optional>
+
+#include "./minefield.hpp"
+#include "./move.hpp"
+
+/**
+ * Something that picks the moves of a game instead of the mouse, like 
+ * a solver. A player only has to reveal and flag mines.
+ * 
+ * A player is given the whole board, but should only look at what a 
+ * person could see: the discovered mines, their counts and the flags.
+ */
+class Player
+{
+
+public:
+
+    virtual ~Player() = default;
+
+    /**
+     * Called when a game starts on a board, before any move
+     */
+    virtual void start(const Minefield& board);
+
+    /**
+     * Picks the next move on a board, which is a `Move::Reveal` or a 
+     * `Move::Flag`. Returns nothing if the player has no move to make.
+     */
+    virtual std::optional<Move> getMove(const Minefield& board) = 0;
+
+    /**
+     * How a game that was played without a window ended
+     */
+    struct Result
+    {
+        bool won = false, lost = false;
+        std::size_t moves = 0;
+    };
+
+    /**
+     * Plays a whole game without a window. The bombs are placed around 
+     * the first reveal at a grid position, just like in the game, and 
+     * then the player makes moves until the game is won or lost, or it 
+     * has no move to make.
+     */
+    Result play(Minefield& board, int x, int y);
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,104 @@
+#ifndef __PROBABILITIES_HPP__
+#define __PROBABILITIES_HPP__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "./minefield.hpp"
+
+/**
+ * Works out how likely each hidden mine of a `Minefield` is to be a bomb,
+ * exactly, from what a player can see: the counts of the discovered mines
+ * and the number of bombs on the board. Flags are treated as hidden mines,
+ * since a flag can be wrong.
+ *
+ * The hidden mines next to discovered mines (the frontier) are split into
+ * components that share no counts. The arrangements of the bombs of each
+ * component are counted, and the components are combined with the hidden
+ * mines away from the frontier using the bomb count.
+ *
+ * The arrangements of a component are cached by its shape, so an update
+ * after a move only counts the components that the move changed.
+ */
+class Probabilities
+{
+
+    const Minefield& board;
+
+    /**
+     * The chance of every mine to be a bomb, indexed like the board
+     */
+    std::vector<double> probabilities;
+
+    /**
+     * The arrangements of the bombs of a component, for every number of
+     * bombs in it. A long component has more arrangements than a double
+     * holds, so the counts are divided by a common scale as they are 
+     * counted, which doesn't change the probabilities.
+     */
+    struct Arrangements
+    {
+        // The number of arrangements with k bombs
+        std::vector<double> counts;
+
+        // The number of those arrangements with a bomb on each mine,
+        // `bombs[k * size + mine]`
+        std::vector<double> bombs;
+
+        std::size_t size;
+
+        // The shape of the component, and the last update that used it
+        std::vector<std::uint32_t> shape;
+        std::size_t used;
+    };
+
+    /**
+     * Arrangements of components keyed by the hash of the shape of the
+     * component: its counts, and which of its mines they cover. Mines 
+     * are numbered within the component, so the same shape anywhere on
+     * the board has the same arrangements.
+     */
+    std::unordered_map<std::uint64_t, Arrangements> cache;
+
+    std::size_t updates = 0, hits = 0, misses = 0, components = 0;
+
+    /**
+     * Counts the arrangements of a component one mine at a time. The
+     * arrangements of the mines so far are merged by what the counts that
+     * are still open need, so a long frontier is counted in about linear
+     * time instead of trying every arrangement.
+     */
+    static Arrangements count(const std::vector<std::uint32_t>& shape, std::size_t size);
+
+public:
+
+    /**
+     * Creates the probabilities of a board, which has to outlive it. They
+     * are not worked out until the first update.
+     */
+    Probabilities(const Minefield& board);
+
+    /**
+     * Works out the probabilities again from the board. It should be
+     * called after the moves that changed the board.
+     */
+    void update();
+
+    /**
+     * The chance that a mine is a bomb. Discovered mines are 0,
+     * unless they are a discovered bomb.
+     */
+    double get(int x, int y) const;
+
+    /**
+     * Statistics of the updates: the number of components in the last
+     * update, and how often their arrangements were in the cache
+     */
+    std::size_t getComponentCount() const;
+    std::size_t getCacheHits() const;
+    std::size_t getCacheMisses() const;
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,134 @@
+#ifndef __SERVER_HPP__
+#define __SERVER_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "./minefield.hpp"
+#include "./utils/thread_pool.hpp"
+
+/**
+ * Hosts many independent games without a window, and plays the requests
+ * of clients on them. Each request is a line of words, and is answered
+ * by one line:
+ *
+ *     new <cols> <rows> <bombs> [<seed>]   game <id>
+ *     open <id> <x> <y>                    <playing | won | lost> <opened> <safe left> <flags>
+ *     flag <id> <x> <y>                    <playing | won | lost> 0 <safe left> <flags>
+ *     restart <id> [<seed>]                playing 0 <safe left> 0
+ *     view <id> <x> <y> <w> <h>            view <a character per mine, row by row>
+ *     close <id>                           closed
+ *
+ * A request that can't be played is answered with `error <reason>`. The
+ * bombs of a game, which have to be fewer than its mines, are placed
+ * around its first open so that it is safe, and a lost game reveals all
+ * of its mines. In a view, a hidden mine is `.`, a flag is `F`, a bomb
+ * is `*` and an opened mine is its count.
+ *
+ * The games are split into shards, and a batch of requests is played
+ * with one task per shard on a `ThreadPool`. A shard is only ever used
+ * by the task that plays its requests, so the games are never locked,
+ * and the requests of a game are played in the order they came in. The
+ * id of a game is its slot in its shard times the number of shards plus
+ * the shard, and the slots of closed games are reused.
+ */
+class Server
+{
+
+public:
+
+    /**
+     * A line from a client, without its newline, and the line that
+     * answers it
+     */
+    struct Request
+    {
+        std::string_view line;
+        std::string response;
+    };
+
+private:
+
+    enum class Outcome : std::uint8_t { Playing, Won, Lost };
+
+    struct Game
+    {
+        Minefield board;
+        bool started = false;
+        Outcome outcome = Outcome::Playing;
+
+        Game(std::size_t cols, std::size_t rows, std::size_t bombs);
+    };
+
+    struct Shard
+    {
+        std::vector<std::unique_ptr<Game>> games;
+
+        // The slots of the games that were closed
+        std::vector<std::size_t> freed;
+
+        /**
+         * The requests of the shard in the batch being played, as the
+         * index of the request and the slot of its game
+         */
+        std::vector<std::pair<std::size_t, std::size_t>> requests;
+
+        std::size_t live = 0;
+    };
+
+    std::vector<Shard> shards;
+
+    // The shard that the next new game goes to
+    std::size_t nextShard = 0;
+
+    // Declared last, so the threads stop before the games are freed
+    ThreadPool pool;
+
+    /**
+     * Finds the shard and the slot of a request, and reserves a slot for
+     * a new game. Returns false after answering a request that has no game.
+     */
+    bool route(Request& request, std::size_t& shard, std::size_t& slot);
+
+    // Plays a request on the game in a slot of a shard, and answers it
+    void play(std::size_t shard, std::size_t slot, Request& request);
+
+public:
+
+    /**
+     * The shards of each thread, so that a thread that finishes its
+     * shards early can take those of another
+     */
+    static constexpr std::size_t SHARDS_PER_THREAD = 4;
+
+    /**
+     * The most mines that a game or a view can have, so that a client
+     * can't take all of the memory of the server
+     */
+    static constexpr std::size_t MAX_MINES = 1 << 24, MAX_VIEW = 1 << 16;
+
+    /**
+     * Creates a server that plays the games on a number of threads
+     */
+    Server(std::size_t threads = std::thread::hardware_concurrency());
+
+    /**
+     * Plays a batch of requests and answers every one of them. The
+     * requests of the same game are played in order.
+     */
+    void handle(std::vector<Request>& requests);
+
+    /**
+     * The games that were created and not closed
+     */
+    std::size_t getGameCount() const;
+
+    std::size_t getThreadCount() const;
+
+};
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef __SOLVER_HPP__
+#define __SOLVER_HPP__
+
+#include <vector>
+
+#include "./player.hpp"
+
+/**
+ * A player that works out safe mines and bombs from the counts of the 
+ * discovered mines, and flags every bomb it finds.
+ * 
+ * It uses two rules. A count that has as many bombs left as hidden 
+ * mines around it, or none, settles all of them. A count whose hidden 
+ * mines are all around another count settles the mines that only the 
+ * other count has, if the difference of the counts is all or none of 
+ * them. When neither rule settles a mine, it guesses the mine that 
+ * looks least likely to be a bomb, unless guessing is turned off.
+ */
+class Solver : public Player
+{
+
+    /**
+     * A discovered mine with hidden mines around it, and the 
+     * number of bombs left in them
+     */
+    struct Count
+    {
+        int bombs;
+        std::vector<std::size_t> hidden;
+    };
+
+    std::vector<Count> counts;
+
+    /**
+     * The count of each mine, or -1 if it has none. It is kept
+     * between moves so that its memory can be reused.
+     */
+    std::vector<int> countOf;
+
+    /**
+     * Moves that were worked out but not made yet
+     */
+    std::vector<Move> moves;
+
+    bool guessing;
+    std::size_t guesses = 0;
+
+    /**
+     * Works out the counts of the board, and adds every move that the 
+     * rules settle to `moves`. If they settle nothing, returns the move
+     * to make instead: the first reveal of a game, or a guess, which 
+     * sets `guessed`. Returns nothing if no mine is hidden.
+     */
+    std::optional<Move> solve(const Minefield& board, bool& guessed);
+
+    /**
+     * Returns true if a move would still change the board
+     */
+    static bool isUseful(const Minefield& board, const Move& move);
+
+public:
+
+    /**
+     * Creates a solver that guesses when it is stuck, or that gives up
+     */
+    Solver(bool guessing = true);
+
+    void start(const Minefield& board) override;
+    std::optional<Move> getMove(const Minefield& board) override;
+
+    /**
+     * The number of guesses since the solver was created
+     */
+    std::size_t getGuesses() const;
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef __BATCHES_HPP__
+#define __BATCHES_HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "./random_engine.hpp"
+#include "./thread_pool.hpp"
+
+namespace Batches
+{
+    /**
+     * Runs a number of items, e.g. games or boards, in batches on a pool
+     * of threads, and returns the state of every thread.
+     *
+     * Every batch has its own stream of random numbers, jumped ahead from
+     * the seed, so the results don't depend on which thread ran which
+     * batch, or on the number of threads. A thread makes its state with
+     * `create`, which returns a `std::unique_ptr`, before its first batch
+     * and reuses it for the batches after. `play(state, engine, count)`
+     * runs a batch of `count` items. A thread that ran no batch has no
+     * state.
+     */
+    template <typename Create, typename Play>
+    inline auto run(
+        ThreadPool& pool, std::uint64_t items, std::uint64_t batch, std::uint64_t seed,
+        Create create, Play play)
+    {
+        std::vector<decltype(create())> states(pool.getThreadCount());
+
+        Random::Engine stream = Random::getStream(seed, 0);
+
+        for (std::uint64_t first = 0; first < items; first += batch) {
+            std::uint64_t count = std::min(batch, items - first);
+
+            pool.submit([&, engine = stream, count](std::size_t thread) mutable {
+                if (!states[thread])
+                    states[thread] = create();
+
+                play(*states[thread], engine, count);
+            });
+
+            // The next batch gets a stream that never overlaps this one
+            stream.jump();
+        }
+
+        pool.wait();
+
+        return states;
+    }
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef __GLYPH_ATLAS_HPP__
+#define __GLYPH_ATLAS_HPP__
+
+#include <optional>
+#include <string>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+namespace GlyphAtlas
+{
+
+    /**
+     * Every label that can be written on a mine, in the order that 
+     * they are placed in the atlas.
+     */
+    const std::string GLYPHS = "12345678BF";
+
+    /**
+     * A texture with every label pre-rendered in white, one tile 
+     * of the size of a mine for each label.
+     */
+    struct Atlas 
+    {
+        sf::RenderTexture texture;
+        sf::Vector2u cellSize;
+
+        /**
+         * Returns the texture rectangle of a label, or an empty
+         * rectangle if the atlas doesn't have that label.
+         */
+        sf::FloatRect getRect(char glyph) const;
+    };
+
+    /**
+     * A immutable reference to an atlas that can be null. 
+     */
+    using AtlasLoad = std::optional<std::reference_wrapper<const Atlas>>;
+
+    /**
+     * Renders every label with a font at a cell size. The atlas is only
+     * rendered again when the cell size (or font) changes.
+     * 
+     * Returns an atlas on success, and a null option on failure.
+     */
+    AtlasLoad load(const std::string& path, sf::Vector2u cellSize);
+
+}
+
+#endif
\ No newline at end of file
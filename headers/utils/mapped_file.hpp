@@ -0,0 +1,52 @@
+#ifndef __MAPPED_FILE_HPP__
+#define __MAPPED_FILE_HPP__
+
+#include <cstddef>
+#include <string>
+
+/**
+ * A file that is mapped into memory, so that its contents can be used 
+ * in place without reading them.
+ * 
+ * The mapping is private, so the contents can be changed in memory, 
+ * but the changes never reach the file. Pages are only read from the 
+ * file once they are touched.
+ */
+class MappedFile
+{
+
+    char* data = nullptr;
+    std::size_t size = 0;
+
+public:
+
+    /**
+     * An empty mapping, that has no file
+     */
+    MappedFile() = default;
+
+    /**
+     * Maps a whole file, and throws if it can't be opened or mapped
+     */
+    MappedFile(const std::string& path);
+
+    /**
+     * A mapping has a single owner, which unmaps it
+     */
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other);
+    MappedFile& operator=(MappedFile&& other);
+
+    ~MappedFile();
+
+    /**
+     * The contents of the file, and their size in bytes
+     */
+    char* getData() const;
+    std::size_t getSize() const;
+
+};
+
+#endif
\ No newline at end of file
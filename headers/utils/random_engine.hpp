@@ -1,29 +1,174 @@
 #ifndef __RANDOM_ENGINE_HPP__
 #define __RANDOM_ENGINE_HPP__
 
+#include <cstdint>
+#include <limits>
 #include <random>
 #include <functional>
 
 namespace Random
 {
+    /**
+     * One step of splitmix64. Advances a state and returns a well mixed
+     * 64-bit number, which is used to turn a seed into engine state.
+     */
+    inline std::uint64_t splitMix(std::uint64_t& state)
+    {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * The xoshiro256** generator. It has 32 bytes of state, is seeded 
+     * from a single 64-bit seed and can be used with any of the standard 
+     * distributions and algorithms.
+     */
+    class Xoshiro256 
+    {
+        std::uint64_t state[4];
+
+        static inline std::uint64_t rotate(std::uint64_t x, int k)
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+    public:
+
+        using result_type = std::uint64_t;
+
+        explicit Xoshiro256(std::uint64_t seed)
+        {
+            for (auto& word : state)
+                word = splitMix(seed);
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()()
+        {
+            const std::uint64_t result = rotate(state[1] * 5, 7) * 9;
+            const std::uint64_t t = state[1] << 17;
+
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+
+            state[2] ^= t;
+            state[3] = rotate(state[3], 45);
+
+            return result;
+        }
+
+        /**
+         * Advances the generator by 2^128 numbers, so that streams made
+         * by jumping never overlap.
+         */
+        void jump()
+        {
+            const std::uint64_t JUMP[] = { 
+                0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 
+                0xa9582618e03fc9aa, 0x39abdc4529b1661c 
+            };
+
+            std::uint64_t jumped[4] = { 0, 0, 0, 0 };
+
+            for (auto word : JUMP) {
+                for (int bit = 0; bit < 64; ++bit) {
+                    if (word & (std::uint64_t(1) << bit)) {
+                        for (int i = 0; i < 4; ++i)
+                            jumped[i] ^= state[i];
+                    }
+                    (*this)();
+                }
+            }
+
+            for (int i = 0; i < 4; ++i)
+                state[i] = jumped[i];
+        }
+    };
+
+    /**
+     * The engine used to generate boards. Everything that generates a 
+     * board goes through this alias, so it can be swapped in one place.
+     */
+    using Engine = Xoshiro256;
+
+    /**
+     * Returns a number in [0, bound) from the 64-bit numbers of an engine,
+     * with Lemire's multiply-shift and a rejection of the few numbers that
+     * would make it uneven. Unlike the standard distributions, whose method
+     * is up to the library, it picks the same numbers on every platform,
+     * so a seed places the same bombs everywhere.
+     */
+    template <typename Generator>
+    inline std::uint64_t bounded(Generator& engine, std::uint64_t bound)
+    {
+        static_assert(
+            Generator::min() == 0 && Generator::max() == std::numeric_limits<std::uint64_t>::max(), 
+            "The engine should give every 64-bit number"
+        );
+
+        unsigned __int128 product = static_cast<unsigned __int128>(engine()) * bound;
+        std::uint64_t low = static_cast<std::uint64_t>(product);
+
+        if (low < bound) {
+            // 2^64 mod bound, the numbers that are one too many
+            std::uint64_t threshold = -bound % bound;
+
+            while (low < threshold) {
+                product = static_cast<unsigned __int128>(engine()) * bound;
+                low = static_cast<std::uint64_t>(product);
+            }
+        }
+
+        return static_cast<std::uint64_t>(product >> 64);
+    }
+
+    /**
+     * Returns a seed that is different every time the program runs
+     */
+    inline std::uint64_t getSeed()
+    {
+        std::random_device device;
+        return (std::uint64_t(device()) << 32) ^ device();
+    }
+
+    /**
+     * Returns an engine for one of many independent streams of numbers
+     * from the same seed, e.g. one stream for each thread.
+     */
+    inline Engine getStream(std::uint64_t seed, std::size_t stream)
+    {
+        Engine engine { seed };
+
+        for (std::size_t i = 0; i < stream; ++i)
+            engine.jump();
+
+        return engine;
+    }
+
     template <typename T>
     inline auto getEngine(
         const T &min = std::numeric_limits<T>::min(),
         const T &max = std::numeric_limits<T>::max())
     {
 
-        std::mt19937 twister{std::random_device{}()};
+        Engine engine { getSeed() };
 
         if constexpr (std::is_integral<T>::value)
-            return std::bind(std::uniform_int_distribution<T>(min, max), twister);
+            return std::bind(std::uniform_int_distribution<T>(min, max), engine);
         else
-            return std::bind(std::uniform_real_distribution<T>(min, max), twister);
+            return std::bind(std::uniform_real_distribution<T>(min, max), engine);
 
     }
 
     inline auto getEngine() 
     {
-        return std::mt19937 { std::random_device{}() };
+        return Engine { getSeed() };
     }
 }
 
@@ -0,0 +1,77 @@
+#ifndef __SAMPLING_HPP__
+#define __SAMPLING_HPP__
+
+#include <vector>
+
+#include "./random_engine.hpp"
+
+namespace Sampling
+{
+    /**
+     * Picks `count` different indices in [0, size) with Floyd's algorithm, 
+     * which only takes `count` random numbers and needs no extra memory.
+     * The numbers are bounded with `Random::bounded`, so the same engine
+     * picks the same indices with any standard library.
+     * 
+     * The caller keeps the set of picked indices: `isPicked(index)` asks if
+     * an index was already picked, and `pick(index)` adds it. Indices in 
+     * `excluded`, which has to be sorted, are never picked.
+     */
+    template <typename Engine, typename IsPicked, typename Pick>
+    inline void floyd(
+        std::size_t size, std::size_t count,
+        const std::vector<std::size_t>& excluded,
+        Engine& engine, IsPicked isPicked, Pick pick)
+    {
+        std::size_t available = size - excluded.size();
+
+        if (count > available)
+            count = available;
+
+        // Skips over the excluded indices
+        auto toIndex = [&excluded](std::size_t index) {
+            for (auto skip : excluded)
+                index += (index >= skip);
+            return index;
+        };
+
+        for (std::size_t j = available - count; j < available; ++j) {
+            std::size_t t = toIndex(Random::bounded(engine, j + 1));
+
+            // If t was already picked, j can't have been, so pick j instead
+            pick(isPicked(t) ? toIndex(j) : t);
+        }
+    }
+
+    /**
+     * Returns the sorted indices of a grid position and its neighbors, which 
+     * should be kept free of bombs so that a first click opens an area.
+     * 
+     * If the bombs don't fit around the neighbors, only the position itself
+     * is kept free, and if they don't fit around that either, nothing is.
+     */
+    inline std::vector<std::size_t> getSafeArea(
+        std::size_t cols, std::size_t rows, std::size_t bombs, 
+        int x, int y)
+    {
+        std::vector<std::size_t> area;
+
+        for (int j = -1; j <= 1; ++j) {
+            for (int i = -1; i <= 1; ++i) {
+                int xi = x + i, yj = y + j;
+
+                if (xi >= 0 && xi < (int) cols && yj >= 0 && yj < (int) rows)
+                    area.push_back(yj * cols + xi);
+            }
+        }
+
+        if (bombs + area.size() <= cols * rows)
+            return area;
+        else if (bombs + 1 <= cols * rows)
+            return { y * cols + x };
+        else
+            return {};
+    }
+}
+
+#endif
\ No newline at end of file
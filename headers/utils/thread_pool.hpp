@@ -0,0 +1,88 @@
+#ifndef __THREAD_POOL_HPP__
+#define __THREAD_POOL_HPP__
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of threads that run tasks, with a queue of tasks for each
+ * thread. A thread runs the newest task of its own queue, and once it
+ * runs out, it steals the oldest task of another queue, so uneven tasks
+ * still keep every thread busy.
+ * 
+ * A task is given the index of the thread that runs it, so it can use
+ * state that belongs to that thread, like a board that is reused.
+ */
+class ThreadPool
+{
+
+public:
+
+    using Task = std::function<void(std::size_t)>;
+
+private:
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+
+    /**
+     * Tasks that are in a queue, and tasks that are not finished. A task
+     * can be taken just before it is counted as queued, so `queued` can 
+     * be briefly negative.
+     */
+    std::atomic<long> queued { 0 };
+    std::atomic<std::size_t> pending { 0 }, next { 0 };
+    bool stopping = false;
+
+    /**
+     * Threads sleep while every queue is empty, and `wait` sleeps 
+     * until every task is finished
+     */
+    std::mutex sleeping;
+    std::condition_variable wake, finished;
+
+    bool take(std::size_t thread, Task& task);
+    void run(std::size_t thread);
+
+public:
+
+    /**
+     * Starts a number of threads, which is one per core by default
+     */
+    ThreadPool(std::size_t threads = std::thread::hardware_concurrency());
+
+    /**
+     * Finishes the tasks that are queued, and stops the threads
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Adds a task to the queues, which are filled in turn
+     */
+    void submit(Task task);
+
+    /**
+     * Waits until every task that was submitted is finished
+     */
+    void wait();
+
+    std::size_t getThreadCount() const;
+
+};
+
+#endif
\ No newline at end of file
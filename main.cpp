@@ -1,30 +1,14 @@
 #include <iostream>
 #include <cstring>
+#include <string>
 
 #include "./headers/minesweeper.hpp"
+#include "./headers/difficulty.hpp"
+#include "./headers/solver.hpp"
 
-/**
- * This struct describes how to create a 
- * minefield game board.
- */
-struct Difficulty
-{
-
-    const std::size_t cols, rows, bombs;
-
-    Difficulty(std::size_t cols, std::size_t rows, std::size_t bombs) :
-        cols { cols }, rows { rows }, bombs { bombs }
-    {
-    }
-
-    const static Difficulty EASY;
-    const static Difficulty INTERMIEDIATE;
-    const static Difficulty EXPERT;
-
-    const static Difficulty DEFAULT;
-};
-
-// Prototype for a parsing function
+// Prototypes for parsing functions
+const char * takeFlag(int& argc, char ** argv, const char * name);
+bool takeSwitch(int& argc, char ** argv, const char * name);
 Difficulty getDifficulty(int argc, char ** argv);
 
 /////////
@@ -35,13 +19,50 @@ int main(int argc, char ** argv)
     -std=c++17 -lsfml-system -lsfml-window -lsfml-graphics  
     */
 
+    // --seed replays the boards of a session from its first seed
+    const char * seedFlag = takeFlag(argc, argv, "--seed");
+
+    std::uint64_t seed = seedFlag ? 
+        std::stoull(seedFlag) : 
+        Random::getSeed();
+
+    // --fps caps the frame rate, --vsync syncs it to the display and
+    // --stats prints the frame rate and CPU usage
+    const char * fpsFlag = takeFlag(argc, argv, "--fps");
+    bool vsync = takeSwitch(argc, argv, "--vsync");
+    bool stats = takeSwitch(argc, argv, "--stats");
+
+    // --journal records every move, so the session can be replayed
+    const char * journalFlag = takeFlag(argc, argv, "--journal");
+
+    // --solver lets the solver play instead of the mouse
+    bool solver = takeSwitch(argc, argv, "--solver");
+
+    // --noguess only deals boards that can be solved without guessing
+    bool noGuess = takeSwitch(argc, argv, "--noguess");
+
     auto [ cols, rows, bombs ] = getDifficulty(argc, argv); 
 
     Minesweeper game{
         900, 900,
-        cols, rows, bombs
+        cols, rows, bombs,
+        seed
     };
 
+    if (fpsFlag)
+        game.setFrameLimit(std::stoul(fpsFlag));
+
+    game.setVerticalSync(vsync);
+    game.setStats(stats);
+
+    if (journalFlag)
+        game.setJournal(journalFlag);
+
+    if (solver)
+        game.setPlayer(std::make_unique<Solver>());
+
+    game.setNoGuess(noGuess);
+
     std::cout << "Running\n";
     while (game.isPlaying()) {
         game.execute();
@@ -53,13 +74,48 @@ int main(int argc, char ** argv)
 /////////
 
 /**
- * These are the preset constants for minefield difficulty
+ * This function removes a flag and its value from the command 
+ * line arguments, and returns the value. If the flag isn't there,
+ * it returns null.
+ */
+const char * takeFlag(int& argc, char ** argv, const char * name)
+{
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(name, argv[i]) == 0) {
+            if (i + 1 >= argc)
+                throw std::runtime_error(std::string("Missing a value for ") + name);
+
+            const char * value = argv[i + 1];
+
+            for (int j = i; j + 2 < argc; ++j)
+                argv[j] = argv[j + 2];
+
+            argc -= 2;
+            return value;
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * This function removes a flag without a value from the command 
+ * line arguments, and returns true if it was there.
  */
-const Difficulty Difficulty::EASY = Difficulty(8, 8, 10);
-const Difficulty Difficulty::INTERMIEDIATE = Difficulty(16, 16, 40);
-const Difficulty Difficulty::EXPERT = Difficulty(16, 30, 90);
+bool takeSwitch(int& argc, char ** argv, const char * name)
+{
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(name, argv[i]) == 0) {
+            for (int j = i; j + 1 < argc; ++j)
+                argv[j] = argv[j + 1];
+
+            argc -= 1;
+            return true;
+        }
+    }
 
-const Difficulty Difficulty::DEFAULT = Difficulty::INTERMIEDIATE;
+    return false;
+}
 
 /**
  * This function parses the command line arguments and 
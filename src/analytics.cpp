@@ -0,0 +1,236 @@
+#include "../headers/analytics.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+
+    /**
+     * The header at the start of a file of histograms, in the byte order
+     * of the machine that wrote it. The sections start right after it.
+     */
+    struct HistogramsHeader
+    {
+        char magic[8];
+        std::uint32_t version, headerSize;
+        std::uint64_t sections;
+    };
+
+    /**
+     * The header of the counts of one metric on boards of one size. The
+     * counts are of the values from `first` to `first + length - 1`.
+     */
+    struct SectionHeader
+    {
+        std::uint64_t cols, rows, bombs, boards;
+        std::uint32_t metric, first, length, padding;
+    };
+
+    static_assert(sizeof(HistogramsHeader) == 24, "The histograms header should have no gaps");
+    static_assert(sizeof(SectionHeader) == 48, "The section header should have no gaps");
+
+    const char HISTOGRAMS_MAGIC[8] = { 'M', 'I', 'N', 'E', 'S', 'T', 'A', 'T' };
+    const std::uint32_t HISTOGRAMS_VERSION = 1;
+
+    // The order of the metrics in a file
+    enum Metric : std::uint32_t { BBBV, Openings, Isolated };
+
+    // Adds to the count of a value, growing the counts up to it
+    void addCount(std::vector<std::uint64_t>& counts, std::size_t value, std::uint64_t count)
+    {
+        if (value >= counts.size())
+            counts.resize(value + 1, 0);
+
+        counts[value] += count;
+    }
+
+}
+
+/************
+ * ANALYSIS *
+ ************/
+
+void Analytics::readRow(const Minefield& board, std::size_t y, std::vector<unsigned char>& kinds) const
+{
+    for (std::size_t x = 0; x < board.cols; ++x) {
+        const Mine& mine = board.get(x, y);
+
+        kinds[x + 1] =
+            mine.bomb ? 0 :
+            mine.neighbors == 0 ? OPENING :
+            NUMBER;
+    }
+}
+
+std::uint32_t Analytics::find(std::uint32_t run)
+{
+    while (parents[run] != run)
+        run = parents[run] = parents[parents[run]];
+
+    return run;
+}
+
+Analytics::Metrics Analytics::analyze(const Minefield& board)
+{
+    const std::size_t cols = board.cols, rows = board.rows;
+
+    Metrics metrics;
+    std::size_t joins = 0;
+
+    above.assign(cols + 2, 0);
+    row.assign(cols + 2, 0);
+    below.assign(cols + 2, 0);
+
+    aboveRuns.clear();
+    parents.clear();
+
+    if (rows > 0)
+        readRow(board, 0, row);
+
+    for (std::size_t y = 0; y < rows; ++y) {
+        if (y + 1 < rows)
+            readRow(board, y + 1, below);
+        else
+            std::fill(below.begin(), below.end(), 0);
+
+        // The runs of the row, joined to the runs above that they touch
+        runs.clear();
+        std::size_t other = 0;
+
+        for (std::size_t x = 0; x < cols; ++x) {
+            if (row[x + 1] != OPENING || row[x] == OPENING)
+                continue;
+
+            Run run { (std::uint32_t) x, (std::uint32_t) x, (std::uint32_t) parents.size() };
+
+            while (run.last + 1 < cols && row[run.last + 2] == OPENING)
+                run.last++;
+
+            parents.push_back(run.id);
+
+            // Runs above that end before this one can't touch the ones after it
+            while (other < aboveRuns.size() && aboveRuns[other].last + 1 < run.first)
+                other++;
+
+            for (std::size_t i = other; i < aboveRuns.size() && aboveRuns[i].first <= run.last + 1; ++i) {
+                std::uint32_t a = find(run.id), b = find(aboveRuns[i].id);
+
+                if (a != b) {
+                    parents[std::max(a, b)] = std::min(a, b);
+                    joins++;
+                }
+            }
+
+            runs.push_back(run);
+            x = run.last;
+        }
+
+        // Numbers without an opening around them
+        for (std::size_t x = 0; x < cols; ++x) {
+            if (row[x + 1] != NUMBER)
+                continue;
+
+            unsigned char around =
+                above[x] | above[x + 1] | above[x + 2] |
+                row[x] | row[x + 2] |
+                below[x] | below[x + 1] | below[x + 2];
+
+            metrics.isolated += !(around & OPENING);
+        }
+
+        std::swap(above, row);
+        std::swap(row, below);
+        std::swap(aboveRuns, runs);
+    }
+
+    metrics.openings = parents.size() - joins;
+    metrics.bbbv = metrics.openings + metrics.isolated;
+
+    return metrics;
+}
+
+/**************
+ * HISTOGRAMS *
+ **************/
+
+Analytics::Histograms::Histograms(std::size_t cols, std::size_t rows, std::size_t bombs) :
+    cols { cols },
+    rows { rows },
+    bombs { bombs }
+{
+}
+
+void Analytics::Histograms::add(const Metrics& metrics)
+{
+    boards++;
+    addCount(bbbv, metrics.bbbv, 1);
+    addCount(openings, metrics.openings, 1);
+    addCount(isolated, metrics.isolated, 1);
+}
+
+void Analytics::Histograms::add(const Histograms& histograms)
+{
+    boards += histograms.boards;
+
+    const std::pair<std::vector<std::uint64_t>*, const std::vector<std::uint64_t>*> metrics[] = {
+        { &bbbv, &histograms.bbbv },
+        { &openings, &histograms.openings },
+        { &isolated, &histograms.isolated }
+    };
+
+    // From the largest value down, so that the counts grow only once
+    for (auto [ counts, added ] : metrics) {
+        for (std::size_t value = added->size(); value-- > 0; )
+            addCount(*counts, value, (*added)[value]);
+    }
+}
+
+void Analytics::save(const std::string& path, const std::vector<Histograms>& histograms)
+{
+    std::ofstream file { path, std::ios::binary | std::ios::trunc };
+
+    HistogramsHeader header {};
+
+    std::memcpy(header.magic, HISTOGRAMS_MAGIC, sizeof(HISTOGRAMS_MAGIC));
+    header.version = HISTOGRAMS_VERSION;
+    header.headerSize = sizeof(HistogramsHeader);
+    header.sections = histograms.size() * 3;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const Histograms& board : histograms) {
+        const std::pair<Metric, const std::vector<std::uint64_t>*> metrics[] = {
+            { BBBV, &board.bbbv },
+            { Openings, &board.openings },
+            { Isolated, &board.isolated }
+        };
+
+        for (auto [ metric, counts ] : metrics) {
+            // Only the values that some board had are written
+            auto nonzero = [](std::uint64_t count) { return count != 0; };
+
+            auto first = std::find_if(counts->begin(), counts->end(), nonzero);
+            auto last = std::find_if(counts->rbegin(), counts->rend(), nonzero).base();
+
+            SectionHeader section {};
+            section.cols = board.cols;
+            section.rows = board.rows;
+            section.bombs = board.bombs;
+            section.boards = board.boards;
+            section.metric = metric;
+            section.first = first - counts->begin();
+            section.length = first < last ? last - first : 0;
+
+            file.write(reinterpret_cast<const char*>(&section), sizeof(section));
+
+            if (section.length > 0)
+                file.write(reinterpret_cast<const char*>(&*first), section.length * sizeof(std::uint64_t));
+        }
+    }
+
+    if (!file.flush())
+        throw std::runtime_error("Could not write histograms to " + path);
+}
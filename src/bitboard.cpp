@@ -0,0 +1,372 @@
+#include "../headers/bitboard.hpp"
+#include "../headers/utils/random_engine.hpp"
+#include "../headers/utils/sampling.hpp"
+
+#include <algorithm>
+#include <bitset>
+
+namespace
+{
+    using Word = std::uint64_t;
+
+    /**
+     * The bit to the left (x - 1) and right (x + 1) of every bit in a 
+     * word of a row, carrying bits over from the words next to it.
+     */
+    inline Word west(const Word* row, std::size_t w)
+    {
+        return (row[w] << 1) | (w > 0 ? row[w - 1] >> 63 : 0);
+    }
+
+    inline Word east(const Word* row, std::size_t w, std::size_t words)
+    {
+        return (row[w] >> 1) | (w + 1 < words ? row[w + 1] << 63 : 0);
+    }
+
+    /**
+     * Fills a row of seeds through every run of set bits in a mask that 
+     * a seed is in. Each word is filled with Kogge-Stone steps, first 
+     * towards the end of the row and then towards the start.
+     */
+    void fillRow(Word* seeds, const Word* mask, std::size_t words)
+    {
+        Word carry = 0;
+
+        for (std::size_t w = 0; w < words; ++w) {
+            Word gen = seeds[w] | (carry & mask[w]);
+            Word pro = mask[w];
+
+            gen |= pro & (gen << 1);  pro &= pro << 1;
+            gen |= pro & (gen << 2);  pro &= pro << 2;
+            gen |= pro & (gen << 4);  pro &= pro << 4;
+            gen |= pro & (gen << 8);  pro &= pro << 8;
+            gen |= pro & (gen << 16); pro &= pro << 16;
+            gen |= pro & (gen << 32);
+
+            seeds[w] = gen;
+            carry = gen >> 63;
+        }
+
+        carry = 0;
+
+        for (std::size_t w = words; w-- > 0;) {
+            Word gen = seeds[w] | ((carry << 63) & mask[w]);
+            Word pro = mask[w];
+
+            gen |= pro & (gen >> 1);  pro &= pro >> 1;
+            gen |= pro & (gen >> 2);  pro &= pro >> 2;
+            gen |= pro & (gen >> 4);  pro &= pro >> 4;
+            gen |= pro & (gen >> 8);  pro &= pro >> 8;
+            gen |= pro & (gen >> 16); pro &= pro >> 16;
+            gen |= pro & (gen >> 32);
+
+            seeds[w] = gen;
+            carry = gen & 1;
+        }
+    }
+}
+
+/***********
+ * HELPERS *
+ ***********/
+
+inline std::size_t Bitboard::getWord(int x, int y) const
+{
+    return y * words + x / 64;
+}
+
+inline Bitboard::Word Bitboard::getBit(int x) const
+{
+    return Word(1) << (x % 64);
+}
+
+void Bitboard::placeBombs(const std::vector<std::size_t>& safe)
+{
+    // Each board has its own seed, and picks the seed of the next board
+    seed = nextSeed;
+
+    std::uint64_t state = seed;
+    nextSeed = Random::splitMix(state);
+
+    Random::Engine engine { seed };
+
+    auto toWord = [this](std::size_t index) { return getWord(index % cols, index / cols); };
+    auto toBit = [this](std::size_t index) { return getBit(index % cols); };
+
+    Sampling::floyd(
+        cols * rows, bombs, safe, engine,
+        [&](std::size_t index) { return (bombMask[toWord(index)] & toBit(index)) != 0; },
+        [&](std::size_t index) { bombMask[toWord(index)] |= toBit(index); }
+    );
+}
+
+void Bitboard::countNeighbors()
+{
+    const std::vector<Word> empty(words, 0);
+
+    for (std::size_t y = 0; y < rows; ++y) {
+        const Word* above = y > 0 ? &bombMask[(y - 1) * words] : empty.data();
+        const Word* middle = &bombMask[y * words];
+        const Word* below = y + 1 < rows ? &bombMask[(y + 1) * words] : empty.data();
+
+        for (std::size_t w = 0; w < words; ++w) {
+            const Word neighbors[8] = {
+                west(above, w), above[w], east(above, w, words),
+                west(middle, w),          east(middle, w, words),
+                west(below, w), below[w], east(below, w, words)
+            };
+
+            // Four bit adder, one adder for each bit of the word
+            Word c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+
+            for (Word bit : neighbors) {
+                Word carry0 = c0 & bit;  c0 ^= bit;
+                Word carry1 = c1 & carry0; c1 ^= carry0;
+                Word carry2 = c2 & carry1; c2 ^= carry1;
+                c3 |= carry2;
+            }
+
+            Word mask = w + 1 == words ? lastMask : ~Word(0);
+            std::size_t index = y * words + w;
+
+            counts[0][index] = c0;
+            counts[1][index] = c1;
+            counts[2][index] = c2;
+            counts[3][index] = c3;
+
+            zeros[index] = ~(c0 | c1 | c2 | c3) & ~middle[w] & mask;
+        }
+    }
+}
+
+Bitboard::Bitboard(std::size_t cols, std::size_t rows, std::size_t bombs) : 
+    cols { cols },
+    rows { rows }, 
+    bombs { bombs > cols * rows ? cols * rows : bombs }
+{
+    words = (cols + 63) / 64;
+    lastMask = cols % 64 == 0 ? ~Word(0) : (Word(1) << (cols % 64)) - 1;
+
+    auto size = rows * words;
+
+    bombMask.resize(size);
+    revealed.resize(size);
+    flags.resize(size);
+    zeros.resize(size);
+    fresh.resize(size);
+
+    for (auto& count : counts)
+        count.resize(size);
+
+    queued.resize(rows);
+
+    filled.resize(words);
+    spread.resize(words);
+    fillable.resize(words);
+
+    resetAll();
+}
+
+/***********
+ * GETTERS *
+ ***********/
+
+std::uint64_t Bitboard::getSeed() const
+{
+    return seed;
+}
+
+void Bitboard::setSeed(std::uint64_t seed)
+{
+    nextSeed = seed;
+}
+
+bool Bitboard::inBounds(int x, int y) const
+{
+    return x >= 0 && static_cast<std::size_t>(x) < cols && y >= 0 && static_cast<std::size_t>(y) < rows;
+}
+
+bool Bitboard::bomb(int x, int y) const
+{
+    return bombMask[getWord(x, y)] & getBit(x);
+}
+
+bool Bitboard::discovered(int x, int y) const
+{
+    return revealed[getWord(x, y)] & getBit(x);
+}
+
+bool Bitboard::flagged(int x, int y) const
+{
+    return flags[getWord(x, y)] & getBit(x);
+}
+
+int Bitboard::getNeighbors(int x, int y) const
+{
+    std::size_t index = getWord(x, y);
+    Word bit = getBit(x);
+
+    return 
+        ((counts[0][index] & bit) ? 1 : 0) |
+        ((counts[1][index] & bit) ? 2 : 0) |
+        ((counts[2][index] & bit) ? 4 : 0) |
+        ((counts[3][index] & bit) ? 8 : 0);
+}
+
+std::size_t Bitboard::getMemoryUsage() const
+{
+    std::size_t words = 
+        bombMask.capacity() + revealed.capacity() + flags.capacity() + zeros.capacity() + 
+        fresh.capacity() + filled.capacity() + spread.capacity() + fillable.capacity();
+
+    for (const auto& count : counts)
+        words += count.capacity();
+
+    return 
+        words * sizeof(Word) + 
+        frontier.capacity() * sizeof(std::size_t) + 
+        (queued.capacity() + 7) / 8;
+}
+
+bool Bitboard::won() const
+{
+    for (std::size_t y = 0; y < rows; ++y) {
+        for (std::size_t w = 0; w < words; ++w) {
+            Word mask = w + 1 == words ? lastMask : ~Word(0);
+            std::size_t index = y * words + w;
+
+            if ((revealed[index] | bombMask[index]) != mask)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/***********
+ * SETTERS *
+ ***********/
+
+std::size_t Bitboard::open(int x, int y)
+{
+    if (!inBounds(x, y) || discovered(x, y) || bomb(x, y) || flagged(x, y))
+        return 0;
+
+    revealed[getWord(x, y)] |= getBit(x);
+    std::size_t opened = 1;
+
+    if (!(zeros[getWord(x, y)] & getBit(x)))
+        return opened;
+
+    // An opening is connected, so the rows it opened mines in are too
+    fresh[getWord(x, y)] |= getBit(x);
+    std::size_t top = y, bottom = y;
+
+    frontier.clear();
+    frontier.push_back(y);
+    queued[y] = true;
+
+    while (!frontier.empty()) {
+        std::size_t row = frontier.back();
+        frontier.pop_back();
+        queued[row] = false;
+
+        const Word* rowZeros = &zeros[row * words];
+
+        // Fill the zeros that this reveal opened through the zeros they 
+        // touch in the row, which were hidden and not flagged before it
+        for (std::size_t w = 0; w < words; ++w) {
+            std::size_t index = row * words + w;
+
+            filled[w] = fresh[index] & rowZeros[w];
+            fillable[w] = rowZeros[w] & ~flags[index] & ~(revealed[index] & ~fresh[index]);
+        }
+
+        fillRow(filled.data(), fillable.data(), words);
+
+        // Every zero opens the mines to its left and right...
+        for (std::size_t w = 0; w < words; ++w)
+            spread[w] = filled[w] | west(filled.data(), w) | east(filled.data(), w, words);
+
+        // ...in its own row and the rows above and below it
+        for (std::size_t r = row > 0 ? row - 1 : row; r <= row + 1 && r < rows; ++r) {
+            bool newZeros = false;
+
+            for (std::size_t w = 0; w < words; ++w) {
+                std::size_t index = r * words + w;
+                Word mask = w + 1 == words ? lastMask : ~Word(0);
+
+                Word added = spread[w] & ~revealed[index] & ~bombMask[index] & ~flags[index] & mask;
+
+                revealed[index] |= added;
+                fresh[index] |= added;
+                opened += std::bitset<64>(added).count();
+
+                newZeros |= (added & zeros[index]) != 0;
+            }
+
+            // The new zeros in this row were already filled through
+            if (newZeros && r != row && !queued[r]) {
+                frontier.push_back(r);
+                queued[r] = true;
+            }
+
+            top = std::min(top, r);
+            bottom = std::max(bottom, r);
+        }
+    }
+
+    std::fill(fresh.begin() + top * words, fresh.begin() + (bottom + 1) * words, 0);
+
+    return opened;
+}
+
+bool Bitboard::reveal(int x, int y)
+{
+    if (!inBounds(x, y))
+        return false;
+
+    open(x, y);
+
+    return !flagged(x, y) && bomb(x, y);
+}
+
+void Bitboard::revealAll()
+{
+    for (std::size_t y = 0; y < rows; ++y) {
+        for (std::size_t w = 0; w < words; ++w)
+            revealed[y * words + w] = w + 1 == words ? lastMask : ~Word(0);
+    }
+
+    std::fill(flags.begin(), flags.end(), 0);
+}
+
+void Bitboard::resetAll()
+{
+    std::fill(bombMask.begin(), bombMask.end(), 0);
+    std::fill(revealed.begin(), revealed.end(), 0);
+    std::fill(flags.begin(), flags.end(), 0);
+
+    placeBombs({});
+    countNeighbors();
+}
+
+void Bitboard::resetAll(int x, int y)
+{
+    std::fill(bombMask.begin(), bombMask.end(), 0);
+    std::fill(revealed.begin(), revealed.end(), 0);
+    std::fill(flags.begin(), flags.end(), 0);
+
+    placeBombs(Sampling::getSafeArea(cols, rows, bombs, x, y));
+    countNeighbors();
+}
+
+bool Bitboard::flag(int x, int y)
+{
+    if (discovered(x, y))
+        return true;
+
+    flags[getWord(x, y)] ^= getBit(x);
+
+    return false;
+}
\ No newline at end of file
@@ -0,0 +1,362 @@
+#include "../headers/chunked_minefield.hpp"
+#include "../headers/utils/sampling.hpp"
+
+#include <algorithm>
+
+/***********
+ * HELPERS *
+ ***********/
+
+inline ChunkedMinefield::Coord ChunkedMinefield::getChunk(Coord position)
+{
+    // Rounds down for negative positions too
+    return position >= 0 ? 
+        position / CHUNK : 
+        (position - (CHUNK - 1)) / CHUNK;
+}
+
+inline ChunkedMinefield::Key ChunkedMinefield::getKey(Coord cx, Coord cy)
+{
+    return { cx, cy };
+}
+
+inline std::size_t ChunkedMinefield::KeyHash::operator()(const Key& key) const
+{
+    // Each coordinate goes through splitmix64, so that nearby chunks spread over the buckets
+    std::uint64_t state = std::uint64_t(key.first);
+    std::uint64_t mixed = Random::splitMix(state) ^ std::uint64_t(key.second);
+
+    return Random::splitMix(mixed);
+}
+
+ChunkedMinefield::Rows ChunkedMinefield::generate(Coord cx, Coord cy) const
+{
+    // Every chunk has its own engine, mixed from the seed and its coordinates
+    std::uint64_t state = 
+        seed ^ 
+        (std::uint64_t(cx) * 0x9e3779b97f4a7c15) ^ 
+        (std::uint64_t(cy) * 0xc2b2ae3d27d4eb4f);
+
+    Random::Engine engine { Random::splitMix(state) };
+
+    // The part of the safe area that is inside of this chunk
+    std::vector<std::size_t> safe;
+
+    if (hasSafe) {
+        for (int j = -1; j <= 1; ++j) {
+            for (int i = -1; i <= 1; ++i) {
+                Coord x = safeX + i, y = safeY + j;
+
+                if (getChunk(x) == cx && getChunk(y) == cy)
+                    safe.push_back((y - cy * CHUNK) * CHUNK + (x - cx * CHUNK));
+            }
+        }
+
+        std::sort(safe.begin(), safe.end());
+    }
+
+    Rows bombs {};
+
+    Sampling::floyd(
+        CHUNK_CELLS, bombsPerChunk, safe, engine,
+        [&bombs](std::size_t index) { return (bombs[index / CHUNK] >> (index % CHUNK)) & 1; },
+        [&bombs](std::size_t index) { bombs[index / CHUNK] |= Row(1) << (index % CHUNK); }
+    );
+
+    return bombs;
+}
+
+ChunkedMinefield::Rows ChunkedMinefield::getBombs(Coord cx, Coord cy) const
+{
+    const Chunk* chunk = find(cx, cy);
+
+    return chunk ? chunk->bombs : generate(cx, cy);
+}
+
+ChunkedMinefield::Chunk& ChunkedMinefield::load(Coord cx, Coord cy)
+{
+    Key key = getKey(cx, cy);
+
+    if (lastChunk && lastKey == key)
+        return *lastChunk;
+
+    auto entry = chunks.find(key);
+
+    if (entry == chunks.end()) {
+        auto chunk = std::make_unique<Chunk>();
+
+        chunk->bombs = generate(cx, cy);
+        chunk->revealed = {};
+        chunk->flags = {};
+
+        // The bombs of the chunk with a border of the bombs around it
+        const int width = CHUNK + 2;
+        std::array<unsigned char, width * width> padded {};
+
+        for (int j = -1; j <= 1; ++j) {
+            for (int i = -1; i <= 1; ++i) {
+                Rows bombs = (i == 0 && j == 0) ? chunk->bombs : getBombs(cx + i, cy + j);
+
+                // The part of the neighboring chunk that borders this one
+                int x0 = i < 0 ? CHUNK - 1 : 0, x1 = i > 0 ? 1 : CHUNK;
+                int y0 = j < 0 ? CHUNK - 1 : 0, y1 = j > 0 ? 1 : CHUNK;
+
+                for (int y = y0; y < y1; ++y) {
+                    for (int x = x0; x < x1; ++x) {
+                        int px = x + i * CHUNK + 1, py = y + j * CHUNK + 1;
+                        padded[py * width + px] = (bombs[y] >> x) & 1;
+                    }
+                }
+            }
+        }
+
+        // Same 3x3 sum as `Minefield::countNeighbors`
+        for (int y = 0; y < CHUNK; ++y) {
+            for (int x = 0; x < CHUNK; ++x) {
+                const unsigned char* above = &padded[y * width + x];
+                const unsigned char* middle = &padded[(y + 1) * width + x];
+                const unsigned char* below = &padded[(y + 2) * width + x];
+
+                chunk->neighbors[y * CHUNK + x] = 
+                    above[0] + above[1] + above[2] + 
+                    middle[0] + middle[2] + 
+                    below[0] + below[1] + below[2];
+            }
+        }
+
+        entry = chunks.emplace(key, std::move(chunk)).first;
+    }
+
+    lastKey = key;
+    lastChunk = entry->second.get();
+
+    return *lastChunk;
+}
+
+const ChunkedMinefield::Chunk* ChunkedMinefield::find(Coord cx, Coord cy) const
+{
+    Key key = getKey(cx, cy);
+
+    if (lastChunk && lastKey == key)
+        return lastChunk;
+
+    auto entry = chunks.find(key);
+
+    return entry == chunks.end() ? nullptr : entry->second.get();
+}
+
+ChunkedMinefield::ChunkedMinefield(std::size_t bombsPerChunk) : 
+    bombsPerChunk { std::clamp(bombsPerChunk, CHUNK_CELLS / 8, CHUNK_CELLS - 9) }
+{
+    resetAll();
+}
+
+/***********
+ * GETTERS *
+ ***********/
+
+std::uint64_t ChunkedMinefield::getSeed() const
+{
+    return seed;
+}
+
+void ChunkedMinefield::setSeed(std::uint64_t seed)
+{
+    nextSeed = seed;
+}
+
+bool ChunkedMinefield::bomb(Coord x, Coord y) const
+{
+    Coord cx = getChunk(x), cy = getChunk(y);
+    Row row = getBombs(cx, cy)[y - cy * CHUNK];
+
+    return (row >> (x - cx * CHUNK)) & 1;
+}
+
+bool ChunkedMinefield::discovered(Coord x, Coord y) const
+{
+    Coord cx = getChunk(x), cy = getChunk(y);
+    const Chunk* chunk = find(cx, cy);
+
+    return chunk && ((chunk->revealed[y - cy * CHUNK] >> (x - cx * CHUNK)) & 1);
+}
+
+bool ChunkedMinefield::flagged(Coord x, Coord y) const
+{
+    Coord cx = getChunk(x), cy = getChunk(y);
+    const Chunk* chunk = find(cx, cy);
+
+    return chunk && ((chunk->flags[y - cy * CHUNK] >> (x - cx * CHUNK)) & 1);
+}
+
+int ChunkedMinefield::getNeighbors(Coord x, Coord y) const
+{
+    Coord cx = getChunk(x), cy = getChunk(y);
+    const Chunk* chunk = find(cx, cy);
+
+    if (chunk)
+        return chunk->neighbors[(y - cy * CHUNK) * CHUNK + (x - cx * CHUNK)];
+
+    // The neighbors are in at most two chunks across and two down, and 
+    // the bombs of each of those are generated once
+    Coord firstX = getChunk(x - 1), firstY = getChunk(y - 1);
+
+    Rows near[2][2];
+    bool generated[2][2] = {};
+
+    int neighbors = 0;
+
+    for (int j = -1; j <= 1; ++j) {
+        for (int i = -1; i <= 1; ++i) {
+            if (i == 0 && j == 0)
+                continue;
+
+            Coord px = x + i, py = y + j;
+            Coord pcx = getChunk(px), pcy = getChunk(py);
+            Rows& bombs = near[pcy - firstY][pcx - firstX];
+
+            if (!generated[pcy - firstY][pcx - firstX]) {
+                bombs = getBombs(pcx, pcy);
+                generated[pcy - firstY][pcx - firstX] = true;
+            }
+
+            neighbors += (bombs[py - pcy * CHUNK] >> (px - pcx * CHUNK)) & 1;
+        }
+    }
+
+    return neighbors;
+}
+
+/***********
+ * SETTERS *
+ ***********/
+
+std::size_t ChunkedMinefield::open(Coord x, Coord y)
+{
+    // Opens a mine if it can be opened, and returns true if it was a zero
+    auto tryOpen = [this](Coord x, Coord y, bool& zero) {
+        Coord cx = getChunk(x), cy = getChunk(y);
+        Chunk& chunk = load(cx, cy);
+
+        int lx = x - cx * CHUNK, ly = y - cy * CHUNK;
+        Row bit = Row(1) << lx;
+
+        if ((chunk.revealed[ly] | chunk.bombs[ly] | chunk.flags[ly]) & bit)
+            return false;
+
+        chunk.revealed[ly] |= bit;
+        zero = chunk.neighbors[ly * CHUNK + lx] == 0;
+
+        return true;
+    };
+
+    bool zero = false;
+
+    if (!tryOpen(x, y, zero))
+        return 0;
+
+    std::size_t opened = 1;
+
+    frontier.clear();
+
+    if (zero)
+        frontier.push_back({ x, y });
+
+    while (!frontier.empty()) {
+        auto [ px, py ] = frontier.back();
+        frontier.pop_back();
+
+        for (int j = -1; j <= 1; ++j) {
+            for (int i = -1; i <= 1; ++i) {
+                if (tryOpen(px + i, py + j, zero)) {
+                    opened++;
+
+                    if (zero)
+                        frontier.push_back({ px + i, py + j });
+                }
+            }
+        }
+    }
+
+    return opened;
+}
+
+bool ChunkedMinefield::reveal(Coord x, Coord y)
+{
+    open(x, y);
+
+    return !flagged(x, y) && bomb(x, y);
+}
+
+void ChunkedMinefield::resetAll()
+{
+    chunks.clear();
+    lastChunk = nullptr;
+
+    // Each board has its own seed, and picks the seed of the next board
+    seed = nextSeed;
+
+    std::uint64_t state = seed;
+    nextSeed = Random::splitMix(state);
+
+    hasSafe = false;
+}
+
+void ChunkedMinefield::resetAll(Coord x, Coord y)
+{
+    resetAll();
+
+    hasSafe = true;
+    safeX = x;
+    safeY = y;
+}
+
+bool ChunkedMinefield::flag(Coord x, Coord y)
+{
+    Coord cx = getChunk(x), cy = getChunk(y);
+    Chunk& chunk = load(cx, cy);
+
+    int lx = x - cx * CHUNK, ly = y - cy * CHUNK;
+    Row bit = Row(1) << lx;
+
+    if (chunk.revealed[ly] & bit)
+        return true;
+
+    chunk.flags[ly] ^= bit;
+
+    return false;
+}
+
+/**********
+ * MEMORY *
+ **********/
+
+std::size_t ChunkedMinefield::getChunkCount() const
+{
+    return chunks.size();
+}
+
+std::size_t ChunkedMinefield::evictUntouched()
+{
+    std::size_t evicted = 0;
+
+    for (auto entry = chunks.begin(); entry != chunks.end();) {
+        const Chunk& chunk = *entry->second;
+
+        bool touched = false;
+
+        for (int y = 0; y < CHUNK; ++y)
+            touched |= (chunk.revealed[y] | chunk.flags[y]) != 0;
+
+        if (touched)
+            ++entry;
+        else {
+            entry = chunks.erase(entry);
+            evicted++;
+        }
+    }
+
+    lastChunk = nullptr;
+
+    return evicted;
+}
\ No newline at end of file
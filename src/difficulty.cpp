@@ -0,0 +1,44 @@
+#include "../headers/difficulty.hpp"
+
+#include <stdexcept>
+
+//////////////
+
+Difficulty::Difficulty(std::size_t cols, std::size_t rows, std::size_t bombs) :
+    cols { cols }, rows { rows }, bombs { bombs }
+{
+}
+
+/**
+ * These are the preset constants for minefield difficulty
+ */
+const Difficulty Difficulty::EASY = Difficulty(8, 8, 10);
+const Difficulty Difficulty::INTERMIEDIATE = Difficulty(16, 16, 40);
+const Difficulty Difficulty::EXPERT = Difficulty(16, 30, 90);
+
+const Difficulty Difficulty::DEFAULT = Difficulty::INTERMIEDIATE;
+
+std::vector<std::pair<std::string, Difficulty>> Difficulty::parse(const std::vector<std::string>& words)
+{
+    std::vector<std::pair<std::string, Difficulty>> difficulties;
+
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        if (words[i] == "easy")
+            difficulties.push_back({ words[i], EASY });
+        else if (words[i] == "intermediate")
+            difficulties.push_back({ words[i], INTERMIEDIATE });
+        else if (words[i] == "expert")
+            difficulties.push_back({ words[i], EXPERT });
+        else if (i + 2 < words.size()) {
+            Difficulty difficulty { std::stoul(words[i]), std::stoul(words[i + 1]), std::stoul(words[i + 2]) };
+            difficulties.push_back({ words[i] + "x" + words[i + 1] + "/" + words[i + 2], difficulty });
+            i += 2;
+        }
+        else
+            throw std::runtime_error("Could not parse a difficulty from " + words[i]);
+    }
+
+    return difficulties;
+}
+
+//////////////
\ No newline at end of file
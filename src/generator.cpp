@@ -0,0 +1,135 @@
+#include <algorithm>
+
+#include "../headers/generator.hpp"
+#include "../headers/utils/random_engine.hpp"
+
+Generator::Search::Search(int x, int y, std::uint64_t seed, std::uint64_t budget) :
+    x { x },
+    y { y },
+    seed { seed },
+    solved { budget }
+{
+}
+
+Generator::Generator(std::size_t cols, std::size_t rows, std::size_t bombs, std::size_t threads) :
+    cols { cols },
+    rows { rows },
+    bombs { bombs },
+    budget { std::clamp<std::uint64_t>(MAX_MINES / std::max<std::size_t>(cols * rows, 1), MIN_CANDIDATES, MAX_CANDIDATES) },
+    pool { threads }
+{
+    boards.resize(pool.getThreadCount());
+    solvers.resize(pool.getThreadCount());
+}
+
+Generator::~Generator()
+{
+    if (prepared)
+        prepared->cancelled = true;
+
+    pool.wait();
+}
+
+std::uint64_t Generator::getCandidate(std::uint64_t seed, std::uint64_t candidate)
+{
+    // The candidates are the numbers of splitmix64 from the seed,
+    // so any of them can be made without the ones before it
+    std::uint64_t state = seed + candidate * 0x9e3779b97f4a7c15;
+    return Random::splitMix(state);
+}
+
+std::uint64_t Generator::getCandidates() const
+{
+    return candidates;
+}
+
+/*************
+ * SEARCHING *
+ *************/
+
+std::shared_ptr<Generator::Search> Generator::begin(int x, int y, std::uint64_t seed)
+{
+    auto search = std::make_shared<Search>(x, y, seed, budget);
+    search->running = pool.getThreadCount();
+
+    for (std::size_t i = 0; i < pool.getThreadCount(); ++i)
+        pool.submit([this, search](std::size_t thread) { run(*search, thread); });
+
+    return search;
+}
+
+void Generator::run(Search& search, std::size_t thread)
+{
+    if (!boards[thread]) {
+        boards[thread] = std::make_unique<Minefield>(cols, rows, bombs);
+        solvers[thread] = std::make_unique<Solver>(false);
+    }
+
+    Minefield& board = *boards[thread];
+    Solver& solver = *solvers[thread];
+
+    while (!search.cancelled) {
+        std::uint64_t candidate = search.next++;
+
+        // A candidate after one that was solved would never be used
+        if (candidate >= search.solved)
+            break;
+
+        board.setSeed(getCandidate(search.seed, candidate));
+        candidates++;
+
+        // The solver stops at the first mine it can't settle
+        if (!solver.play(board, search.x, search.y).won) {
+            std::uint64_t left = std::min<std::uint64_t>(board.getSafeLeft(), 0xffffffff);
+            std::uint64_t key = left << 32 | candidate, best = search.best;
+
+            while (key < best && !search.best.compare_exchange_weak(best, key))
+                ;
+
+            continue;
+        }
+
+        std::uint64_t solved = search.solved;
+
+        while (candidate < solved && !search.solved.compare_exchange_weak(solved, candidate))
+            ;
+    }
+
+    std::lock_guard<std::mutex> lock { search.mutex };
+
+    if (--search.running == 0)
+        search.finished.notify_all();
+}
+
+std::uint64_t Generator::find(int x, int y, std::uint64_t seed)
+{
+    std::shared_ptr<Search> search;
+
+    if (prepared && prepared->x == x && prepared->y == y && prepared->seed == seed)
+        search = std::move(prepared);
+    else
+        search = begin(x, y, seed);
+
+    if (prepared) {
+        prepared->cancelled = true;
+        prepared = nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock { search->mutex };
+    search->finished.wait(lock, [&] { return search->running == 0; });
+
+    // Every candidate was rejected, so the one that the solver got
+    // furthest on is used
+    if (search->solved == budget)
+        return getCandidate(seed, search->best & 0xffffffff);
+
+    return getCandidate(seed, search->solved);
+}
+
+void Generator::prepare(int x, int y, std::uint64_t seed)
+{
+    if (prepared)
+        prepared->cancelled = true;
+
+    prepared = begin(x, y, seed);
+}
@@ -0,0 +1,198 @@
+#include "../headers/journal.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+
+    /**
+     * The header at the start of a journal, in the byte order of the
+     * machine that wrote it. The moves start right after it.
+     */
+    struct JournalHeader
+    {
+        char magic[8];
+        std::uint32_t version, headerSize;
+        std::uint64_t cols, rows, bombs;
+        std::uint32_t moveSize, padding;
+    };
+
+    static_assert(sizeof(JournalHeader) == 48, "The journal header should have no gaps");
+
+    const char JOURNAL_MAGIC[8] = { 'M', 'I', 'N', 'E', 'J', 'R', 'N', 'L' };
+    const std::uint32_t JOURNAL_VERSION = 1;
+
+}
+
+/***********
+ * JOURNAL *
+ ***********/
+
+Journal::Journal(const std::string& path, std::size_t cols, std::size_t rows, std::size_t bombs) : 
+    file { path, std::ios::binary | std::ios::trunc },
+    opened { std::chrono::steady_clock::now() }
+{
+    JournalHeader header {};
+
+    std::memcpy(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    header.version = JOURNAL_VERSION;
+    header.headerSize = sizeof(JournalHeader);
+
+    header.cols = cols;
+    header.rows = rows;
+    header.bombs = bombs;
+    header.moveSize = sizeof(Move);
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (!file.flush())
+        throw std::runtime_error("Could not write a journal to " + path);
+}
+
+void Journal::record(Move::Action action, int x, int y, std::uint64_t seed)
+{
+    std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - opened;
+
+    Move move {};
+    move.seed = seed;
+    move.time = static_cast<std::uint32_t>(time.count());
+    move.x = x;
+    move.y = y;
+    move.action = action;
+
+    file.write(reinterpret_cast<const char*>(&move), sizeof(move));
+    file.flush();
+}
+
+/**********
+ * REPLAY *
+ **********/
+
+Replay::Replay(const std::string& path) : 
+    mapping { path }
+{
+    JournalHeader header;
+
+    if (mapping.getSize() < sizeof(header))
+        throw std::runtime_error(path + " is too small to be a journal");
+
+    std::memcpy(&header, mapping.getData(), sizeof(header));
+
+    if (std::memcmp(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0)
+        throw std::runtime_error(path + " is not a journal");
+
+    if (header.version != JOURNAL_VERSION || header.headerSize != sizeof(JournalHeader) || header.moveSize != sizeof(Move))
+        throw std::runtime_error(path + " is a journal of an unsupported version");
+
+    cols = header.cols;
+    rows = header.rows;
+    bombs = header.bombs;
+
+    count = (mapping.getSize() - sizeof(JournalHeader)) / sizeof(Move);
+}
+
+std::size_t Replay::getMoveCount() const
+{
+    return count;
+}
+
+Move Replay::getMove(std::size_t index) const
+{
+    Move move;
+    std::memcpy(&move, mapping.getData() + sizeof(JournalHeader) + index * sizeof(Move), sizeof(Move));
+
+    return move;
+}
+
+std::vector<Replay::Game> Replay::play(Minefield& board) const
+{
+    if (board.cols != cols || board.rows != rows || board.bombs != bombs)
+        throw std::runtime_error("The journal was recorded on a board of a different size");
+
+    std::vector<Game> games;
+
+    bool playing = false;
+    std::size_t clicks = 0;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        Move move = getMove(i);
+
+        bool click = move.action == Move::Reveal || move.action == Move::Flag;
+
+        if (click && (!playing || !board.inBounds(move.x, move.y)))
+            throw std::runtime_error("Move " + std::to_string(i) + " was played outside of a game");
+
+        if (move.action == Move::Start) {
+            // A game starts on a board that was just reset, whose bombs
+            // are placed again in case the first click is a flag
+            board.setSeed(move.seed);
+            board.resetAll();
+
+            playing = true;
+
+            games.emplace_back();
+            games.back().seed = move.seed;
+            games.back().start = move.time;
+        }
+
+        else if (move.action == Move::Reveal) {
+            // The first click places the bombs around it
+            if (clicks == 0) {
+                board.setSeed(move.seed);
+                board.resetAll(move.x, move.y);
+
+                games.back().seed = move.seed;
+            }
+
+            games.back().opened += board.open(move.x, move.y);
+
+            const Mine& mine = board.get(move.x, move.y);
+
+            if (!mine.flagged() && mine.bomb) {
+                playing = false;
+                games.back().lost = true;
+                board.revealAll();
+            }
+
+            // Journals from before games could be won go on after a win
+            else if (board.isWon())
+                games.back().won = true;
+        }
+
+        else if (move.action == Move::Flag) {
+            board.flag(move.x, move.y);
+        }
+
+        else if (move.action == Move::GiveUp) {
+            playing = false;
+
+            // Games used to go on after they were won
+            if (!games.empty() && !games.back().won)
+                games.back().lost = true;
+
+            board.revealAll();
+        }
+
+        else if (move.action == Move::Reset) {
+            playing = false;
+            clicks = 0;
+
+            board.setSeed(move.seed);
+            board.resetAll();
+        }
+
+        if (board.getSeed() != move.seed)
+            throw std::runtime_error("Move " + std::to_string(i) + " was played on a different board");
+
+        if (click) {
+            clicks++;
+            games.back().clicks++;
+        }
+
+        if (!games.empty() && move.action != Move::Reset)
+            games.back().end = move.time;
+    }
+
+    return games;
+}
\ No newline at end of file
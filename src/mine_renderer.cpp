@@ -0,0 +1,150 @@
+#include "../headers/mine_renderer.hpp"
+#include "../headers/utils/utils.hpp"
+#include "../headers/utils/font_loader.hpp"
+
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+
+//////////////
+
+MineRenderer::MineRenderer(const Mine& mine) : 
+    mine { mine }
+{
+}
+
+void MineRenderer::draw(sf::RenderTarget &target, sf::RenderStates states) const
+{
+    auto [top, bottom, size] = Utils::getRectangle(states.transform);
+
+    /**
+     * DRAW RECTANGLE
+     */
+
+    sf::RectangleShape field{};
+    field.setPosition(top);
+    field.setSize(size);
+    field.setFillColor(sf::Color{155, 155, 155});
+
+    field.setOutlineColor(getOutlineColor());
+    field.setOutlineThickness(getOutlineThickness());
+
+    target.draw(field);
+
+    /**
+     * DRAW TEXT ON THE RECTANGLE
+     */
+
+    drawText(target, states);
+}
+
+void MineRenderer::appendShape(sf::VertexArray &vertices, const sf::Transform &transform) const
+{
+    auto [top, bottom, size] = Utils::getRectangle(transform);
+
+    auto appendRectangle = [&vertices](sf::Vector2f min, sf::Vector2f max, sf::Color color) {
+        vertices.append({ { min.x, min.y }, color });
+        vertices.append({ { max.x, min.y }, color });
+        vertices.append({ { max.x, max.y }, color });
+
+        vertices.append({ { min.x, min.y }, color });
+        vertices.append({ { max.x, max.y }, color });
+        vertices.append({ { min.x, max.y }, color });
+    };
+
+    /**
+     * The outline is drawn inside of the rectangle, so that a mine never
+     * covers its neighbors and can be drawn again on its own
+     */
+
+    float thickness = std::min({ getOutlineThickness(), size.x / 2, size.y / 2 });
+    sf::Vector2f outline { thickness, thickness };
+
+    appendRectangle(top, bottom, getOutlineColor());
+    appendRectangle(top + outline, bottom - outline, sf::Color{155, 155, 155});
+}
+
+void MineRenderer::drawText(sf::RenderTarget &target, sf::RenderStates states) const
+{
+    auto fontLoad = FontLoader::load("resources/source-code.ttf");
+
+    if (fontLoad.has_value()) {
+
+        auto [text, color] = getInfo();
+
+        if (text != '\0') {
+            auto [top, bottom, size] = Utils::getRectangle(states.transform);
+
+            top.y -= size.y * 0.2;
+
+            target.draw(Utils::getText(
+                std::string(1, text),
+                *fontLoad,
+                size.y,
+                color,
+                top));
+        }
+    }
+}
+
+void MineRenderer::appendText(sf::VertexArray &vertices, const sf::Transform &transform, const GlyphAtlas::Atlas &atlas) const
+{
+    auto [text, color] = getInfo();
+
+    if (text == '\0')
+        return;
+
+    auto [top, bottom, size] = Utils::getRectangle(transform);
+    sf::FloatRect rect = atlas.getRect(text);
+
+    sf::Vector2f texTop { rect.left, rect.top };
+    sf::Vector2f texBottom { rect.left + rect.width, rect.top + rect.height };
+
+    // The atlas is white, so the vertex color tints the glyph
+    vertices.append({ { top.x, top.y }, color, { texTop.x, texTop.y } });
+    vertices.append({ { bottom.x, top.y }, color, { texBottom.x, texTop.y } });
+    vertices.append({ { bottom.x, bottom.y }, color, { texBottom.x, texBottom.y } });
+
+    vertices.append({ { top.x, top.y }, color, { texTop.x, texTop.y } });
+    vertices.append({ { bottom.x, bottom.y }, color, { texBottom.x, texBottom.y } });
+    vertices.append({ { top.x, bottom.y }, color, { texTop.x, texBottom.y } });
+}
+
+inline sf::Color MineRenderer::getOutlineColor() const
+{
+    return mine.discovered() || mine.flagged() ? 
+        sf::Color{200, 200, 200} : 
+        sf::Color::Black;
+}
+
+inline float MineRenderer::getOutlineThickness() const
+{
+    return mine.discovered() ? 
+        2 : 
+        1;
+}
+
+inline std::pair<char, sf::Color> MineRenderer::getInfo() const
+{
+    char text = '\0';
+    sf::Color color { sf::Color::White };
+
+    if (mine.discovered()) {
+
+        if (mine.bomb) {
+            text = 'B';
+            color = sf::Color::Red;
+        }
+        else if (mine.neighbors > 0) {
+            text = '0' + mine.neighbors;
+        }
+        
+    } else if (mine.flagged()) {
+        text = 'F';
+        color = sf::Color::Blue;
+    }
+
+    return { text, color };
+}
+
+//////////////
\ No newline at end of file
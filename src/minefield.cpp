@@ -1,23 +1,135 @@
 #include "../headers/minefield.hpp"
 #include "../headers/utils/random_engine.hpp"
-#include "../headers/utils/utils.hpp"
+#include "../headers/utils/sampling.hpp"
 
-#include <SFML/Graphics/RenderTarget.hpp>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
 
-void Minefield::shuffleMines()
+void Minefield::placeBombs(const std::vector<std::size_t>& safe)
 {
-    std::shuffle(
-        mines.begin(), 
-        mines.end(), 
-        Random::getEngine()
+    // Each board has its own seed, and picks the seed of the next board
+    seed = nextSeed;
+
+    std::uint64_t state = seed;
+    nextSeed = Random::splitMix(state);
+
+    Random::Engine engine { seed };
+
+    Sampling::floyd(
+        cols * rows, bombs, safe, engine,
+        [this](std::size_t index) { return mines[index].bomb; },
+        [this](std::size_t index) { mines[index].bomb = true; placed.push_back(index); }
     );
 }
 
-void Minefield::setMines(/* int mines */)
+void Minefield::countAround(std::size_t index, int delta)
 {
-    for (int i = 0; i < mines.size(); ++i)
-        mines[i].bomb = (i < bombs);
+    int x = index % cols, y = index / cols;
+
+    for (int j = -1; j <= 1; ++j) {
+        for (int i = -1; i <= 1; ++i) {
+            if ((i != 0 || j != 0) && inBounds(x + i, y + j))
+                mines[(y + j) * cols + (x + i)].neighbors += delta;
+        }
+    }
+}
+
+void Minefield::clear(bool sparse)
+{
+    if (epochs.size() != cols * rows) {
+        for (std::size_t i = 0; i < cols * rows; ++i)
+            mines[i].reset();
+
+        epochs.assign(cols * rows, 0);
+        epoch = 0;
+        placed.clear();
+
+        return;
+    }
+
+    for (auto index : placed) {
+        mines[index].bomb = false;
+
+        if (sparse)
+            countAround(index, -1);
+    }
+
+    placed.clear();
+
+    // Every mine is from an older epoch now, unless the epochs wrapped
+    // around to ones that mines still have
+    if (++epoch == 0) {
+        for (std::size_t i = 0; i < cols * rows; ++i)
+            mines[i].state = Mine::State::Default;
+
+        std::fill(epochs.begin(), epochs.end(), 0);
+    }
+}
+
+void Minefield::reset(const std::vector<std::size_t>& safe)
+{
+    bool sparse = bombs * SPARSE < cols * rows;
+
+    clear(sparse);
+    placeBombs(safe);
+
+    labeled = false;
+
+    safeLeft = cols * rows - placed.size();
+    flags = correctFlags = 0;
+    counted = true;
+
+    if (sparse) {
+        for (auto index : placed)
+            countAround(index, 1);
+    }
+    else
+        countNeighbors();
+
+    markChangedAll();
+}
+
+void Minefield::countNeighbors()
+{
+    const std::size_t width = cols + 2, height = rows + 2;
+
+    // Bombs with a border of empty cells around them
+    std::vector<unsigned char> padded(width * height, 0);
+
+    for (std::size_t y = 0; y < rows; ++y) {
+        for (std::size_t x = 0; x < cols; ++x)
+            padded[(y + 1) * width + (x + 1)] = mines[y * cols + x].bomb;
+    }
+
+    // Horizontal pass, sums of each cell with its left and right cell
+    std::vector<unsigned char> sums(width * height, 0);
+
+    for (std::size_t y = 0; y < height; ++y) {
+        const unsigned char* row = &padded[y * width];
+        unsigned char* sum = &sums[y * width];
+
+        for (std::size_t x = 1; x + 1 < width; ++x)
+            sum[x] = row[x - 1] + row[x] + row[x + 1];
+    }
+
+    // Vertical pass, sums of three horizontal sums without the cell itself
+    std::vector<unsigned char> counts(cols);
+
+    for (std::size_t y = 0; y < rows; ++y) {
+        const unsigned char* above = &sums[y * width + 1];
+        const unsigned char* middle = &sums[(y + 1) * width + 1];
+        const unsigned char* below = &sums[(y + 2) * width + 1];
+        const unsigned char* self = &padded[(y + 1) * width + 1];
+
+        for (std::size_t x = 0; x < cols; ++x)
+            counts[x] = above[x] + middle[x] + below[x] - self[x];
+
+        for (std::size_t x = 0; x < cols; ++x)
+            mines[y * cols + x].neighbors = counts[x];
+    }
 }
 
 Minefield::Minefield(std::size_t cols, std::size_t rows, std::size_t bombs) : 
@@ -27,98 +139,171 @@ Minefield::Minefield(std::size_t cols, std::size_t rows, std::size_t bombs) :
 {
     auto size = cols * rows;
 
-    mines.resize(size);
+    storage.resize(size);
+    mines = storage.data();
 
     resetAll();
 }
 
+Minefield::Minefield(MappedFile mapping, std::size_t offset, std::size_t cols, std::size_t rows, std::size_t bombs) : 
+    mapping { std::move(mapping) },
+    cols { cols },
+    rows { rows },
+    bombs { bombs }
+{
+    mines = reinterpret_cast<Mine*>(this->mapping.getData() + offset);
+
+    // Counting would read every page of the file
+    counted = false;
+}
+
 /***********
  * GETTERS *
  ***********/
 
+std::uint64_t Minefield::getSeed() const
+{
+    return seed;
+}
+
+std::uint64_t Minefield::getNextSeed() const
+{
+    return nextSeed;
+}
+
+void Minefield::setSeed(std::uint64_t seed)
+{
+    nextSeed = seed;
+}
+
 bool Minefield::inBounds(int x, int y) const
 {
     return x >= 0 && x < cols && y >= 0 && y < rows;
 }
 
+inline void Minefield::refresh(std::size_t index) const
+{
+    if (index < epochs.size() && epochs[index] != epoch) {
+        mines[index].state = Mine::State::Default;
+        epochs[index] = epoch;
+    }
+}
+
 const Mine& Minefield::get(int x, int y) const
 {
+    refresh(y * cols + x);
     return mines[y * cols + x];
 }
 
 Mine& Minefield::get(int x, int y) 
 {
+    refresh(y * cols + x);
     return mines[y * cols + x];
 }
 
 int Minefield::getNeighbors(int x, int y) const
 {
-    int neighbors = 0;
-
-    int xi, yj;
-
-    for (int j = -1; j <= 1; ++j) {
-        for (int i = -1; i <= 1; ++i) {
-            xi = x + i; yj = y + j;
-
-            if (inBounds(xi, yj) && ((i!=0) || (j!=0)))
-                neighbors += get(xi, yj).bomb;
-        }
-    }
+    return get(x, y).neighbors;
+}
 
-    return neighbors;
+std::size_t Minefield::getMemoryUsage() const
+{
+    return 
+        storage.capacity() * sizeof(Mine) + 
+        epochs.capacity() * sizeof(std::uint8_t) + 
+        runs.capacity() * sizeof(Run) + 
+        (rowRuns.capacity() + openings.capacity() + openingBorders.capacity()) * sizeof(std::size_t) + 
+        (labels.capacity() + byOpening.capacity() + borders.capacity()) * sizeof(std::uint32_t) + 
+        (zerosIn.capacity() + flagsIn.capacity()) * sizeof(std::uint32_t) + 
+        (touched.capacity() + 7) / 8 + 
+        placed.capacity() * sizeof(std::size_t) + 
+        frontier.capacity() * sizeof(std::size_t) + 
+        changes.capacity() * sizeof(std::size_t);
 }
 
 /***********
  * SETTERS *
  ***********/
 
-bool Minefield::reveal(int x, int y)
+std::size_t Minefield::open(int x, int y)
 {
     if (!inBounds(x, y))
-        return false;
+        return 0;
 
-    Mine &mine = get(x, y);
+    auto canOpen = [](const Mine& mine) {
+        return !mine.discovered() && !mine.bomb && !mine.flagged();
+    };
 
-    if (!mine.discovered() && !mine.bomb && !mine.flagged()) {
-        mine.neighbors = getNeighbors(x, y);
-        mine.state = Mine::State::Discovered;
+    if (!canOpen(get(x, y)))
+        return 0;
 
-        if (mine.neighbors == 0) {
-            for (int j = -1; j <= 1; ++j) {
-                for (int i = -1; i <= 1; ++i) {
-                    if (i != 0 || j != 0)
-                        reveal(x + i, y + j);
-                }
-            }
+    std::size_t index = y * cols + x;
+    std::size_t opened = 1;
+
+    if (mines[index].neighbors == 0) {
+        std::uint32_t label = NO_LABEL;
+
+        // The labels only fit boards of up to 2^32 mines
+        if (cols * rows < NO_LABEL) {
+            if (!labeled)
+                labelOpenings();
+
+            label = getLabel(index);
+        }
+
+        if (label != NO_LABEL && flagsIn[label] == 0 && !touched[label])
+            opened = openOpening(label);
+        else {
+            opened = openRuns(index);
+
+            if (label != NO_LABEL)
+                touched[label] = true;
         }
     }
+    else {
+        mines[index].state = Mine::State::Discovered;
+        markChanged(index);
+    }
+
+    safeLeft -= opened;
 
+    return opened;
+}
+
+bool Minefield::reveal(int x, int y)
+{
+    if (!inBounds(x, y))
+        return false;
+
+    open(x, y);
+
+    const Mine &mine = get(x, y);
     return !mine.flagged() && mine.bomb;
 }
 
 void Minefield::revealAll()
 {
-    for (int y = 0; y < rows; ++y) {
-        for (int x = 0; x < cols; ++x) {
-            Mine& mine = get(x, y);
+    // The counters are of the moves of the player, which revealing isn't,
+    // so a loaded board counts them before its mines are all revealed
+    if (!counted)
+        count();
 
-            mine.state = Mine::State::Discovered;
-            mine.neighbors = getNeighbors(x, y);
-        }
-    }
+    for (std::size_t i = 0; i < cols * rows; ++i)
+        mines[i].state = Mine::State::Discovered;
+
+    std::fill(epochs.begin(), epochs.end(), epoch);
 
-    // for (auto& mine : mines)
-        // mine.state = Mine::State::Discovered;
+    markChangedAll();
 }
 
 void Minefield::resetAll()
 {
-    for (auto& mine : mines)
-        mine.reset();
+    reset({});
+}
 
-    setMines();
-    shuffleMines();
+void Minefield::resetAll(int x, int y)
+{
+    reset(Sampling::getSafeArea(cols, rows, bombs, x, y));
 }
 
 bool Minefield::flag(int x, int y)
@@ -132,42 +317,589 @@ bool Minefield::flag(int x, int y)
         Mine::State::Default :
         Mine::State::Flagged;
 
+    markChanged(y * cols + x);
+
+    int delta = mine.flagged() ? 1 : -1;
+
+    flags += delta;
+    correctFlags += mine.bomb ? delta : 0;
+
+    // A flag on a run of an opening stops it from opening from its labels
+    if (labeled && !mine.bomb && mine.neighbors == 0)
+        flagsIn[getLabel(y * cols + x)] += delta;
+
     return false;
 }
 
-/*************
- * RENDERING *
+/************
+ * OPENINGS *
  ************/
 
-sf::Transform Minefield::getMineTransform(const sf::Transform& transform) const
+std::size_t Minefield::openRuns(std::size_t start)
 {
-    auto [ top, bottom, size ] = Utils::getRectangle(transform);
+    // The mines that an opening spreads through, which are the same ones
+    // that opening mine by mine would spread through
+    auto spreads = [this](std::size_t index) {
+        refresh(index);
+        const Mine& mine = mines[index];
+
+        return !mine.discovered() && !mine.flagged() && !mine.bomb && mine.neighbors == 0;
+    };
+
+    // The mines around an opening, which open but don't spread it
+    auto openBorder = [this](std::size_t index) -> std::size_t {
+        refresh(index);
+        Mine& mine = mines[index];
+
+        if (mine.discovered() || mine.flagged() || mine.bomb)
+            return 0;
+
+        mine.state = Mine::State::Discovered;
+        markChanged(index);
+
+        return 1;
+    };
+
+    std::size_t opened = 0;
+
+    frontier.clear();
+    frontier.push_back(start);
+
+    while (!frontier.empty()) {
+        std::size_t index = frontier.back();
+        frontier.pop_back();
 
-    return getMineTransform(top, size);
+        // The run may have been opened from another run since it was pushed
+        if (!spreads(index))
+            continue;
+
+        std::size_t y = index / cols, row = y * cols;
+        std::size_t first = index - row, last = first;
+
+        while (first > 0 && spreads(row + first - 1))
+            first--;
+
+        while (last + 1 < cols && spreads(row + last + 1))
+            last++;
+
+        for (std::size_t x = first; x <= last; ++x) {
+            mines[row + x].state = Mine::State::Discovered;
+            markChanged(row + x);
+        }
+
+        opened += last - first + 1;
+
+        std::size_t left = first > 0 ? first - 1 : first;
+        std::size_t right = last + 1 < cols ? last + 1 : last;
+
+        if (left < first)
+            opened += openBorder(row + left);
+
+        if (right > last)
+            opened += openBorder(row + right);
+
+        // The rows above and below are opened, or start runs of their own
+        for (std::size_t other : { y - 1, y + 1 }) {
+            if (other >= rows)
+                continue;
+
+            bool inRun = false;
+
+            for (std::size_t x = left; x <= right; ++x) {
+                std::size_t neighbor = other * cols + x;
+                bool spreading = spreads(neighbor);
+
+                if (spreading && !inRun)
+                    frontier.push_back(neighbor);
+                else if (!spreading)
+                    opened += openBorder(neighbor);
+
+                inRun = spreading;
+            }
+        }
+    }
+
+    return opened;
 }
 
-sf::Transform Minefield::getMineTransform(const sf::Vector2f& top, const sf::Vector2f& size) const
+void Minefield::labelOpenings()
 {
-    sf::Transform mineTransform {};
-    mineTransform.translate(top);
-    mineTransform.scale({ size.x / (float) cols, size.y / (float) rows });
+    // The runs of each row
+    runs.clear();
+    rowRuns.resize(rows + 1);
+
+    for (std::size_t y = 0; y < rows; ++y) {
+        rowRuns[y] = runs.size();
+        bool inRun = false;
+
+        for (std::size_t x = 0; x < cols; ++x) {
+            const Mine& mine = mines[y * cols + x];
+            bool inOpening = !mine.bomb && mine.neighbors == 0;
+
+            if (inOpening && !inRun)
+                runs.push_back({ (std::uint32_t) y, (std::uint32_t) x, (std::uint32_t) x });
+            else if (inOpening)
+                runs.back().last = x;
+
+            inRun = inOpening;
+        }
+    }
+
+    rowRuns[rows] = runs.size();
+
+    // Each run points to a run of its opening before it, and the first
+    // run of the opening points to itself
+    labels.resize(runs.size());
+
+    auto find = [this](std::uint32_t run) {
+        while (labels[run] != run)
+            run = labels[run] = labels[labels[run]];
+
+        return run;
+    };
+
+    for (std::size_t y = 0; y < rows; ++y) {
+        std::size_t above = y > 0 ? rowRuns[y - 1] : 0;
+
+        for (std::size_t run = rowRuns[y]; run < rowRuns[y + 1]; ++run) {
+            labels[run] = run;
+
+            // Runs of the row above that end before this one starts 
+            // can't touch the runs after it either
+            while (above < rowRuns[y] && runs[above].last + 1 < runs[run].first)
+                above++;
+
+            // Runs touch if they overlap or touch at a corner
+            for (std::size_t other = above; other < rowRuns[y] && runs[other].first <= runs[run].last + 1; ++other) {
+                std::uint32_t a = find(run), b = find(other);
+
+                if (a < b)
+                    labels[b] = a;
+                else if (b < a)
+                    labels[a] = b;
+            }
+        }
+    }
+
+    // The first run of each opening gets the next label, and the runs 
+    // after it take the label of the run they point to, which is before
+    // them and so already has its label
+    std::uint32_t count = 0;
 
-    return mineTransform;
+    for (std::size_t run = 0; run < runs.size(); ++run)
+        labels[run] = labels[run] == run ? count++ : labels[labels[run]];
+
+    // The runs are sorted by their label by counting them
+    openings.assign(count + 1, 0);
+
+    for (std::size_t run = 0; run < runs.size(); ++run)
+        openings[labels[run] + 1]++;
+
+    for (std::uint32_t label = 0; label < count; ++label)
+        openings[label + 1] += openings[label];
+
+    byOpening.resize(runs.size());
+
+    for (std::size_t run = 0; run < runs.size(); ++run)
+        byOpening[openings[labels[run]]++] = run;
+
+    // Counting moved every offset to the start of the next opening
+    for (std::uint32_t label = count; label > 0; --label)
+        openings[label] = openings[label - 1];
+
+    openings[0] = 0;
+
+    // The flags and opened mines of a board that was played or loaded
+    // before the openings were labeled
+    zerosIn.assign(count, 0);
+    flagsIn.assign(count, 0);
+    touched.assign(count, false);
+
+    for (std::size_t run = 0; run < runs.size(); ++run) {
+        std::uint32_t label = labels[run];
+        std::size_t row = runs[run].y * cols;
+
+        for (std::size_t index = row + runs[run].first; index <= row + runs[run].last; ++index) {
+            bool current = index >= epochs.size() || epochs[index] == epoch;
+
+            flagsIn[label] += current && mines[index].flagged();
+            touched[label] = touched[label] || (current && mines[index].discovered());
+        }
+
+        zerosIn[label] += runs[run].last - runs[run].first + 1;
+    }
+
+    // The mines around the openings, found a row at a time from the 
+    // labels of the rows above, at and below it. A mine can be around 
+    // a few openings, and is kept once for each. Each is kept as its 
+    // label and index in one word, reusing the frontier.
+    //
+    // The rows of labels have an unlabeled mine on each side, and the 
+    // fourth one stands for the rows outside of the board.
+    const std::size_t width = cols + 2;
+    std::vector<std::uint32_t> near(4 * width, NO_LABEL);
+
+    auto labelRow = [&](std::size_t y) -> const std::uint32_t* {
+        if (y >= rows)
+            return &near[3 * width];
+
+        std::uint32_t* row = &near[(y % 3) * width];
+        std::fill(row, row + width, NO_LABEL);
+
+        for (std::size_t run = rowRuns[y]; run < rowRuns[y + 1]; ++run)
+            std::fill(row + runs[run].first + 1, row + runs[run].last + 2, labels[run]);
+
+        return row;
+    };
+
+    frontier.clear();
+
+    const std::uint32_t* above = labelRow(rows);
+    const std::uint32_t* at = labelRow(0);
+
+    for (std::size_t y = 0; y < rows; ++y) {
+        const std::uint32_t* below = labelRow(y + 1);
+
+        for (std::size_t x = 0; x < cols; ++x) {
+            const std::uint32_t around[8] = {
+                above[x], above[x + 1], above[x + 2],
+                at[x], at[x + 2],
+                below[x], below[x + 1], below[x + 2]
+            };
+
+            // Nearly every mine is around one opening or none, which 
+            // is the lowest label around it
+            std::uint32_t lowest = NO_LABEL;
+
+            for (auto label : around)
+                lowest = std::min(lowest, label);
+
+            // A mine in a run isn't around an opening, and a bomb never
+            // touches a run, so only the labels are needed
+            if (lowest == NO_LABEL || at[x + 1] != NO_LABEL)
+                continue;
+
+            std::size_t index = y * cols + x;
+            frontier.push_back((std::size_t(lowest) << 32) | index);
+
+            bool others = false;
+
+            for (auto label : around)
+                others |= label != lowest && label != NO_LABEL;
+
+            if (!others)
+                continue;
+
+            std::uint32_t found[8] = { lowest };
+            int counted = 1;
+
+            for (auto label : around) {
+                if (label == NO_LABEL || std::find(found, found + counted, label) != found + counted)
+                    continue;
+
+                found[counted++] = label;
+                frontier.push_back((std::size_t(label) << 32) | index);
+            }
+        }
+
+        above = at;
+        at = below;
+    }
+
+    // The mines around the openings are sorted by their label by counting
+    // them, and stay in the order of the board within each opening
+    openingBorders.assign(count + 1, 0);
+
+    for (auto entry : frontier)
+        openingBorders[(entry >> 32) + 1]++;
+
+    for (std::uint32_t label = 0; label < count; ++label)
+        openingBorders[label + 1] += openingBorders[label];
+
+    borders.resize(frontier.size());
+
+    for (auto entry : frontier)
+        borders[openingBorders[entry >> 32]++] = (std::uint32_t) entry;
+
+    for (std::uint32_t label = count; label > 0; --label)
+        openingBorders[label] = openingBorders[label - 1];
+
+    openingBorders[0] = 0;
+
+    labeled = true;
 }
 
-void Minefield::draw(sf::RenderTarget& target, sf::RenderStates states) const
+std::uint32_t Minefield::getLabel(std::size_t index) const
 {
-    // Draw all the mines
-    sf::Transform mineTransform = getMineTransform(states.transform);
+    std::size_t x = index % cols, y = index / cols;
+
+    // The first run of the row that doesn't end before the mine
+    auto run = std::lower_bound(
+        runs.begin() + rowRuns[y], runs.begin() + rowRuns[y + 1], x,
+        [](const Run& run, std::size_t x) { return run.last < x; }
+    );
 
-    for (int y = 0; y < rows; ++y) {
-        for (int x = 0; x < cols; ++x) {
-            auto mine = get(x, y);
+    if (run == runs.begin() + rowRuns[y + 1] || run->first > x)
+        return NO_LABEL;
 
-            target.draw(mine, sf::Transform(mineTransform).translate(x, y));
-            // mineTransform.translate(1, 1);
-        }   
-        // mineTransform.translate(-cols, 1);
+    return labels[run - runs.begin()];
+}
+
+std::size_t Minefield::openOpening(std::uint32_t label)
+{
+    // Every mine of the runs is hidden, has no flag and no neighboring
+    // bombs, so they all become the same byte
+    std::size_t opened = zerosIn[label];
+
+    for (std::size_t r = openings[label]; r < openings[label + 1]; ++r) {
+        const Run& run = runs[byOpening[r]];
+        std::size_t first = run.y * cols + run.first, last = run.y * cols + run.last;
+
+        Mine open = mines[first];
+        open.state = Mine::State::Discovered;
+
+        std::fill(mines + first, mines + last + 1, open);
+
+        if (!epochs.empty())
+            std::fill(epochs.begin() + first, epochs.begin() + last + 1, epoch);
+
+        markChanged(first, last);
     }
 
+    // The mines around it may have been opened or flagged already
+    for (std::size_t b = openingBorders[label]; b < openingBorders[label + 1]; ++b) {
+        std::size_t index = borders[b];
+        refresh(index);
+
+        Mine& mine = mines[index];
+
+        if (mine.discovered() || mine.flagged())
+            continue;
+
+        mine.state = Mine::State::Discovered;
+        markChanged(index);
+        opened++;
+    }
+
+    touched[label] = true;
+
+    return opened;
+}
+
+/************
+ * COUNTERS *
+ ************/
+
+void Minefield::count() const
+{
+    safeLeft = flags = correctFlags = 0;
+
+    for (std::size_t i = 0; i < cols * rows; ++i) {
+        // Mines from older epochs are hidden
+        bool current = i >= epochs.size() || epochs[i] == epoch;
+
+        const Mine& mine = mines[i];
+
+        safeLeft += !mine.bomb && !(current && mine.discovered());
+        flags += current && mine.flagged();
+        correctFlags += current && mine.flagged() && mine.bomb;
+    }
+
+    counted = true;
+}
+
+std::size_t Minefield::getSafeLeft() const
+{
+    if (!counted)
+        count();
+
+    return safeLeft;
+}
+
+std::size_t Minefield::getFlags() const
+{
+    if (!counted)
+        count();
+
+    return flags;
+}
+
+std::size_t Minefield::getCorrectFlags() const
+{
+    if (!counted)
+        count();
+
+    return correctFlags;
+}
+
+bool Minefield::isWon() const
+{
+    return getSafeLeft() == 0;
+}
+
+/*******************
+ * CHANGE TRACKING *
+ *******************/
+
+void Minefield::markChanged(std::size_t index)
+{
+    if (changedAll)
+        return;
+
+    // Past a quarter of the board, drawing everything is cheaper anyway
+    if (changes.size() >= cols * rows / 4)
+        markChangedAll();
+    else
+        changes.push_back(index);
+}
+
+void Minefield::markChanged(std::size_t first, std::size_t last)
+{
+    if (changedAll)
+        return;
+
+    if (changes.size() + (last - first + 1) > cols * rows / 4)
+        markChangedAll();
+    else {
+        for (std::size_t index = first; index <= last; ++index)
+            changes.push_back(index);
+    }
+}
+
+void Minefield::markChangedAll()
+{
+    changedAll = true;
+    changes.clear();
+}
+
+const std::vector<std::size_t>& Minefield::getChanges() const
+{
+    return changes;
+}
+
+bool Minefield::allChanged() const
+{
+    return changedAll;
+}
+
+void Minefield::clearChanges()
+{
+    changedAll = false;
+    changes.clear();
+}
+
+/*************
+ * SNAPSHOTS *
+ *************/
+
+namespace
+{
+
+    /**
+     * The header at the start of a snapshot, in the byte order of the 
+     * machine that wrote it. The mines start right after it.
+     */
+    struct SnapshotHeader
+    {
+        char magic[8];
+        std::uint32_t version, headerSize;
+        std::uint64_t cols, rows, bombs, seed, nextSeed;
+
+        // The size of a mine, and a mine with every field set, so that
+        // a different layout of the bit fields is noticed
+        std::uint8_t cellSize, cellLayout;
+        std::uint8_t padding[6];
+    };
+
+    static_assert(sizeof(SnapshotHeader) == 64, "The snapshot header should have no gaps");
+
+    const char SNAPSHOT_MAGIC[8] = { 'M', 'I', 'N', 'E', 'S', 'N', 'A', 'P' };
+    const std::uint32_t SNAPSHOT_VERSION = 1;
+
+    std::uint8_t getCellLayout()
+    {
+        // The unused bit of a mine is left as it is, so it is cleared first
+        const std::uint8_t empty = 0;
+
+        Mine mine;
+        std::memcpy(&mine, &empty, sizeof(Mine));
+
+        mine.neighbors = 5;
+        mine.bomb = true;
+        mine.state = Mine::State::Flagged;
+
+        std::uint8_t layout;
+        std::memcpy(&layout, &mine, sizeof(Mine));
+
+        return layout;
+    }
+
+}
+
+void Minefield::save(const std::string& path) const
+{
+    SnapshotHeader header {};
+
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.headerSize = sizeof(SnapshotHeader);
+
+    header.cols = cols;
+    header.rows = rows;
+    header.bombs = bombs;
+    header.seed = seed;
+    header.nextSeed = nextSeed;
+
+    header.cellSize = sizeof(Mine);
+    header.cellLayout = getCellLayout();
+
+    // The mines from older epochs are written as cleared
+    for (std::size_t i = 0; i < cols * rows; ++i)
+        refresh(i);
+
+    std::ofstream file { path, std::ios::binary | std::ios::trunc };
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(mines), cols * rows * sizeof(Mine));
+
+    if (!file.flush())
+        throw std::runtime_error("Could not write a snapshot to " + path);
+}
+
+Minefield Minefield::load(const std::string& path)
+{
+    MappedFile mapping { path };
+
+    SnapshotHeader header;
+
+    if (mapping.getSize() < sizeof(header))
+        throw std::runtime_error(path + " is too small to be a snapshot");
+
+    std::memcpy(&header, mapping.getData(), sizeof(header));
+
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0)
+        throw std::runtime_error(path + " is not a snapshot");
+
+    if (header.version != SNAPSHOT_VERSION || header.headerSize != sizeof(SnapshotHeader))
+        throw std::runtime_error(path + " is a snapshot of an unsupported version");
+
+    if (header.cellSize != sizeof(Mine) || header.cellLayout != getCellLayout())
+        throw std::runtime_error(path + " was written with a different layout of mines");
+
+    // A crafted size could overflow the size of the board, so it is 
+    // bounded before the size is worked out
+    if (header.cols == 0 || header.rows == 0 ||
+        header.rows > (SIZE_MAX - header.headerSize) / sizeof(Mine) / header.cols)
+        throw std::runtime_error(path + " has the wrong size for its board");
+
+    if (header.bombs > header.cols * header.rows ||
+        mapping.getSize() != header.headerSize + header.cols * header.rows * sizeof(Mine))
+        throw std::runtime_error(path + " has the wrong size for its board");
+
+    Minefield board { std::move(mapping), header.headerSize, header.cols, header.rows, header.bombs };
+
+    board.seed = header.seed;
+    board.nextSeed = header.nextSeed;
+
+    return board;
 }
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "../headers/minefield_renderer.hpp"
+#include "../headers/mine_renderer.hpp"
+#include "../headers/utils/utils.hpp"
+#include "../headers/utils/glyph_atlas.hpp"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <algorithm>
+#include <cmath>
+
+MinefieldRenderer::MinefieldRenderer(const Minefield& board) : 
+    board { board },
+    view { 0.0f, 0.0f, (float) board.cols, (float) board.rows }
+{
+}
+
+/**********
+ * CAMERA *
+ **********/
+
+void MinefieldRenderer::setView(const sf::FloatRect& view)
+{
+    this->view = view;
+}
+
+const sf::FloatRect& MinefieldRenderer::getView() const
+{
+    return view;
+}
+
+sf::IntRect MinefieldRenderer::getVisibleMines() const
+{
+    int left = std::max(0, (int) std::floor(view.left));
+    int top = std::max(0, (int) std::floor(view.top));
+    int right = std::min((int) board.cols, (int) std::ceil(view.left + view.width));
+    int bottom = std::min((int) board.rows, (int) std::ceil(view.top + view.height));
+
+    return { left, top, std::max(0, right - left), std::max(0, bottom - top) };
+}
+
+/*************
+ * RENDERING *
+ ************/
+
+sf::Transform MinefieldRenderer::getMineTransform(const sf::Transform& transform) const
+{
+    auto [ top, bottom, size ] = Utils::getRectangle(transform);
+
+    return getMineTransform(top, size);
+}
+
+sf::Transform MinefieldRenderer::getMineTransform(const sf::Vector2f& top, const sf::Vector2f& size) const
+{
+    sf::Transform mineTransform {};
+    mineTransform.translate(top);
+    mineTransform.scale({ size.x / view.width, size.y / view.height });
+    mineTransform.translate(-view.left, -view.top);
+
+    return mineTransform;
+}
+
+void MinefieldRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    auto [ top, bottom, size ] = Utils::getRectangle(states.transform);
+
+    sf::Vector2u pixels {
+        (unsigned) (size.x + 0.5f),
+        (unsigned) (size.y + 0.5f)
+    };
+
+    // Moving the camera changes every mine on the screen
+    bool redrawAll = board.allChanged() || view != cachedView;
+    cachedView = view;
+
+    if (!cached || cache.getSize() != pixels) {
+        cached = cache.create(pixels.x, pixels.y);
+        redrawAll = true;
+
+        // Without a texture, the whole board is drawn every frame
+        if (!cached) {
+            drawBatched(target, states);
+            return;
+        }
+    }
+
+    // The board fills the whole texture
+    sf::Transform transform;
+    transform.scale(pixels.x * 1.0f, pixels.y * 1.0f);
+
+    if (redrawAll) {
+        cache.clear(sf::Color::White);
+        drawBatched(cache, transform);
+    }
+    
+    else if (!board.getChanges().empty()) {
+        sf::Transform mineTransform = getMineTransform(transform);
+        const GlyphAtlas::Atlas* atlas = getAtlas(mineTransform);
+
+        sf::IntRect visible = getVisibleMines();
+
+        for (std::size_t index : board.getChanges()) {
+            if (visible.contains(index % board.cols, index / board.cols))
+                batch(mineTransform, index, atlas);
+        }
+
+        flush(cache, atlas);
+    }
+
+    cache.display();
+
+    sf::Sprite sprite { cache.getTexture() };
+    sprite.setPosition(top);
+
+    target.draw(sprite);
+}
+
+void MinefieldRenderer::drawBatched(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    sf::Transform mineTransform = getMineTransform(states.transform);
+    const GlyphAtlas::Atlas* atlas = getAtlas(mineTransform);
+
+    sf::IntRect visible = getVisibleMines();
+
+    for (int y = visible.top; y < visible.top + visible.height; ++y) {
+        for (int x = visible.left; x < visible.left + visible.width; ++x)
+            batch(mineTransform, y * board.cols + x, atlas);
+    }
+
+    flush(target, atlas);
+}
+
+void MinefieldRenderer::batch(const sf::Transform& mineTransform, std::size_t index, const GlyphAtlas::Atlas* atlas) const
+{
+    int x = index % board.cols, y = index / board.cols;
+
+    MineRenderer mine { board.get(x, y) };
+    sf::Transform transform = sf::Transform(mineTransform).translate(x, y);
+
+    mine.appendShape(vertices, transform);
+
+    // The text is cut out of the glyph atlas
+    if (atlas)
+        mine.appendText(labels, transform, *atlas);
+}
+
+void MinefieldRenderer::flush(sf::RenderTarget& target, const GlyphAtlas::Atlas* atlas) const
+{
+    target.draw(vertices);
+
+    if (atlas)
+        target.draw(labels, &atlas->texture.getTexture());
+
+    vertices.clear();
+    labels.clear();
+}
+
+const GlyphAtlas::Atlas* MinefieldRenderer::getAtlas(const sf::Transform& mineTransform) const
+{
+    auto [ top, bottom, size ] = Utils::getRectangle(mineTransform);
+
+    auto atlasLoad = GlyphAtlas::load("resources/source-code.ttf", {
+        (unsigned) (size.x + 0.5f),
+        (unsigned) (size.y + 0.5f)
+    });
+
+    if (atlasLoad.has_value())
+        return &atlasLoad->get();
+    else
+        return nullptr;
+}
+
+void MinefieldRenderer::drawMines(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    // Draw all the mines
+    sf::Transform mineTransform = getMineTransform(states.transform);
+
+    for (int y = 0; y < board.rows; ++y) {
+        for (int x = 0; x < board.cols; ++x) {
+            MineRenderer mine { board.get(x, y) };
+
+            target.draw(mine, sf::Transform(mineTransform).translate(x, y));
+            // mineTransform.translate(1, 1);
+        }   
+        // mineTransform.translate(-cols, 1);
+    }
+
+}
\ No newline at end of file
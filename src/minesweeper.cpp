@@ -3,13 +3,19 @@
 #include "../headers/utils/font_loader.hpp"
 
 #include <SFML/Window/Event.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <sstream>
+#include <iomanip>
 // Constructor
 
 Minesweeper::Minesweeper(
     std::size_t width, std::size_t height, 
     std::size_t cols,  std::size_t rows,
-    std::size_t bombs
+    std::size_t bombs,
+    std::uint64_t seed
 ) :
     window { 
         sf::VideoMode(width, height), 
@@ -18,6 +24,15 @@ Minesweeper::Minesweeper(
     },
     board { cols, rows, bombs }
 {
+    board.setSeed(seed);
+
+    view = { 
+        0.0f, 0.0f, 
+        std::min((float) cols, MAX_VIEW), 
+        std::min((float) rows, MAX_VIEW) 
+    };
+
+    renderer.setView(view);
 }
 
 // MAIN FUNCTION
@@ -25,55 +40,206 @@ Minesweeper::Minesweeper(
 void Minesweeper::execute()
 {
     handleInput();
-    draw();
+
+    // A player makes a move every frame instead of the mouse
+    if (player && state == GameState::PLAYING) {
+        auto move = player->getMove(board);
+
+        if (move && board.inBounds(move->x, move->y)) {
+            play(*move);
+            changed = true;
+        }
+    }
+
+    if (needsDraw())
+        draw();
+
+    // Only the clock can change while nobody clicks, so wait for its next 
+    // tick in short naps that keep the input responsive
+    else if (state == GameState::PLAYING) {
+        double untilTick = (drawnTick + 1) * TICK - getTimeSeconds();
+        sf::sleep(sf::seconds(std::clamp(untilTick, 0.0, 0.01)));
+    }
+
+    reportStats();
 }
 
 void Minesweeper::handleInput()
 {
     sf::Event event;
+
+    // Nothing on the screen can change while there isn't a game 
+    // being played, so block until something happens
+    if (!needsDraw() && state != GameState::PLAYING) {
+        if (window.waitEvent(event))
+            handleEvent(event);
+    }
+
     while (window.pollEvent(event)) {
-        // handleEvent(event);
+        handleEvent(event);
+    }
+}
 
-        // EXIT FUNCTIONS
+void Minesweeper::handleEvent(const sf::Event &event)
+{
+    // EXIT FUNCTIONS
 
-        if (event.type == sf::Event::Closed) {
+    if (event.type == sf::Event::Closed) {
+        window.close();
+    }
+
+    // KEYBOARD FUNCTIONALITY
+
+    else if (event.type == sf::Event::KeyPressed) {
+        if (event.key.code == sf::Keyboard::Escape) {
             window.close();
         }
 
-        // KEYBOARD FUNCTIONALITY
-
-        else if (event.type == sf::Event::KeyPressed) {
-            if (event.key.code == sf::Keyboard::Escape) {
-                window.close();
+        else if (event.key.code == sf::Keyboard::Space) {
+            if (state == GameState::RESET) {
+                start();
+            } else if (state == GameState::LOST || state == GameState::WON) {
+                reset();
+            } else if (state == GameState::PLAYING) {
+                lose();
+                record(Move::GiveUp);
             }
 
-            else if (event.key.code == sf::Keyboard::Space) {
-                if (state == GameState::RESET) {
-                    start();
-                } else if (state == GameState::LOST) {
-                    reset();
-                } else if (state == GameState::PLAYING) {
-                    lose();
-                }
-            }
+            changed = true;
+        }
+
+        // CAMERA FUNCTIONALITY
+
+        else if (event.key.code == sf::Keyboard::Left) {
+            panView({ -view.width / 10, 0 });
+        } else if (event.key.code == sf::Keyboard::Right) {
+            panView({ view.width / 10, 0 });
+        } else if (event.key.code == sf::Keyboard::Up) {
+            panView({ 0, -view.height / 10 });
+        } else if (event.key.code == sf::Keyboard::Down) {
+            panView({ 0, view.height / 10 });
+        }
+
+        else if (event.key.code == sf::Keyboard::Equal || event.key.code == sf::Keyboard::Add) {
+            auto [ top, bottom, size ] = Utils::getRectangle(getBoardTransform());
+            zoomView(0.8f, (top + bottom) / 2.0f);
+        } else if (event.key.code == sf::Keyboard::Hyphen || event.key.code == sf::Keyboard::Subtract) {
+            auto [ top, bottom, size ] = Utils::getRectangle(getBoardTransform());
+            zoomView(1.25f, (top + bottom) / 2.0f);
+        }
+    }
+    
+    // MOUSE FUNCTIONALITY
+
+    else if (event.type == sf::Event::MouseButtonPressed) {
+        // The middle button drags the camera around
+        if (event.mouseButton.button == sf::Mouse::Middle) {
+            dragging = true;
+            dragPosition = { event.mouseButton.x, event.mouseButton.y };
+        }
+
+        else if (state == GameState::PLAYING) {
+            onClick(event);
+            changed = true;
         }
-        
-        // MOUSE FUNCTIONALITY
+    }
+
+    else if (event.type == sf::Event::MouseButtonReleased) {
+        if (event.mouseButton.button == sf::Mouse::Middle)
+            dragging = false;
+    }
+
+    else if (event.type == sf::Event::MouseMoved) {
+        if (dragging) {
+            auto [ top, bottom, size ] = Utils::getRectangle(getBoardTransform());
+
+            sf::Vector2i position { event.mouseMove.x, event.mouseMove.y };
+            sf::Vector2f moved = static_cast<sf::Vector2f>(dragPosition - position);
 
-        else if (event.type == sf::Event::MouseButtonPressed) {
-            if (state == GameState::PLAYING)
-                onClick(event);
+            panView({ 
+                moved.x * view.width / size.x, 
+                moved.y * view.height / size.y 
+            });
+
+            dragPosition = position;
         }
+    }
 
+    else if (event.type == sf::Event::MouseWheelScrolled) {
+        if (event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
+            zoomView(
+                event.mouseWheelScroll.delta > 0 ? 0.8f : 1.25f,
+                { (float) event.mouseWheelScroll.x, (float) event.mouseWheelScroll.y }
+            );
+        }
     }
+
+    // WINDOW FUNCTIONALITY
+
+    else if (event.type == sf::Event::GainedFocus) {
+        changed = true;
+    }
+}
+
+bool Minesweeper::needsDraw() const
+{
+    return changed || getTick() != drawnTick;
+}
+
+inline long Minesweeper::getTick() const
+{
+    return (long) (getTimeSeconds() / TICK);
 }
 
 void Minesweeper::draw() 
 {
+    changed = false;
+    drawnTick = getTick();
+
     window.clear(sf::Color::White);
     drawBoard();
     drawMenu();
     window.display();
+
+    frames++;
+}
+
+// FRAME PACING
+
+void Minesweeper::setFrameLimit(unsigned int limit)
+{
+    window.setFramerateLimit(limit);
+}
+
+void Minesweeper::setVerticalSync(bool enabled)
+{
+    window.setVerticalSyncEnabled(enabled);
+}
+
+void Minesweeper::setStats(bool enabled)
+{
+    stats = enabled;
+
+    statsClock.restart();
+    statsCpu = std::clock();
+    frames = 0;
+}
+
+void Minesweeper::reportStats()
+{
+    if (!stats)
+        return;
+
+    double wall = statsClock.getElapsedTime().asSeconds();
+
+    if (wall < STATS_PERIOD)
+        return;
+
+    double cpu = (std::clock() - statsCpu) / (double) CLOCKS_PER_SEC;
+
+    std::cout << "fps " << frames / wall << ", cpu " << 100.0 * cpu / wall << "%\n";
+
+    setStats(true);
 }
 
 // BOARD DRAWING UTILS
@@ -94,7 +260,47 @@ void Minesweeper::drawBoard()
     // Transform for the board
     sf::Transform transform = getBoardTransform();
 
-    window.draw(board, transform);
+    window.draw(renderer, transform);
+
+    // The renderer has drawn every change
+    board.clearChanges();
+}
+
+// CAMERA UTILS
+
+void Minesweeper::zoomView(float factor, const sf::Vector2f& anchor)
+{
+    // The mine under the anchor stays in the same place on the screen
+    sf::Vector2f mine = renderer.getMineTransform(getBoardTransform())
+        .getInverse()
+        .transformPoint(anchor);
+
+    float width = std::clamp(view.width * factor, std::min((float) board.cols, MIN_VIEW), std::min((float) board.cols, MAX_VIEW));
+    float height = std::clamp(view.height * factor, std::min((float) board.rows, MIN_VIEW), std::min((float) board.rows, MAX_VIEW));
+
+    view.left = mine.x - (mine.x - view.left) * width / view.width;
+    view.top = mine.y - (mine.y - view.top) * height / view.height;
+    view.width = width;
+    view.height = height;
+
+    clampView();
+}
+
+void Minesweeper::panView(const sf::Vector2f& mines)
+{
+    view.left += mines.x;
+    view.top += mines.y;
+
+    clampView();
+}
+
+void Minesweeper::clampView()
+{
+    view.left = std::clamp(view.left, 0.0f, board.cols - view.width);
+    view.top = std::clamp(view.top, 0.0f, board.rows - view.height);
+
+    renderer.setView(view);
+    changed = true;
 }
 
 // MENU UTILS
@@ -111,7 +317,7 @@ sf::Transform Minesweeper::getMenuTransform() const
 
 inline double Minesweeper::getTimeSeconds() const
 {
-    if (state == GameState::LOST)
+    if (state == GameState::LOST || state == GameState::WON)
         return lastTime;
     else if (state == GameState::PLAYING)
         return timer.getElapsedTime().asSeconds();
@@ -127,8 +333,12 @@ void Minesweeper::drawMenu()
     auto [ top, bottom, size ] = Utils::getRectangle(getMenuTransform());
 
     if (fontLoad.has_value()) {
+        // The clock only changes once a tick
+        std::ostringstream time;
+        time << std::fixed << std::setprecision(1) << getTick() * TICK;
+
         auto text = Utils::getText(
-            std::to_string(getTimeSeconds()),
+            time.str(),
             *fontLoad,
             size.y,
             sf::Color::Black,
@@ -136,6 +346,20 @@ void Minesweeper::drawMenu()
         );
 
         window.draw(text);
+
+        // The bombs that aren't flagged yet, on the right
+        long remaining = (long) board.bombs - (long) board.getFlags();
+
+        auto mines = Utils::getText(
+            std::to_string(remaining),
+            *fontLoad,
+            size.y,
+            state == GameState::WON ? sf::Color::Green : sf::Color::Black
+        );
+
+        mines.setPosition({ bottom.x - mines.getLocalBounds().width - 0.2f * size.y, -0.2f * size.y });
+
+        window.draw(mines);
     }
 
 }
@@ -144,12 +368,16 @@ void Minesweeper::drawMenu()
 
 inline sf::Vector2i Minesweeper::getMineIndex(const sf::Vector2f in) const
 {
-    sf::Transform tfm = board.getMineTransform(getBoardTransform());
+    // Only the camera is inverted, so this doesn't depend on the size of the board
+    sf::Transform tfm = renderer.getMineTransform(getBoardTransform());
     tfm = tfm.getInverse();
 
-    return static_cast<sf::Vector2i>(
-        tfm.transformPoint(in)
-    );
+    sf::Vector2f mine = tfm.transformPoint(in);
+
+    return { 
+        (int) std::floor(mine.x), 
+        (int) std::floor(mine.y) 
+    };
 }
 
 void Minesweeper::onClick(const sf::Event &event)
@@ -163,29 +391,52 @@ void Minesweeper::onClick(const sf::Event &event)
         std::cout << "Mine is out of bounds " << x << ", " << y << "!\n";
 
     else {
+        Move move {};
+        move.x = x;
+        move.y = y;
+
+        if (event.mouseButton.button == sf::Mouse::Left)
+            move.action = Move::Reveal;
+        else if (event.mouseButton.button == sf::Mouse::Right)
+            move.action = Move::Flag;
+        else
+            return;
+
+        play(move);
+    }
 
-        if (event.mouseButton.button == sf::Mouse::Left) {
-            auto bomb = board.reveal(x, y);
+}
 
-            if (clicks == 0) {
-                while (bomb) {
-                    board.resetAll();
-                    bomb = board.reveal(x, y);
-                }
-            } 
+void Minesweeper::play(const Move& move)
+{
+    int x = move.x, y = move.y;
 
-            else if (bomb)
-                lose();
-        }
+    if (move.action == Move::Reveal) {
+        // The first click places the bombs around it
+        if (clicks == 0) {
+            if (generator)
+                board.setSeed(generator->find(x, y, board.getNextSeed()));
 
-        else if (event.mouseButton.button == sf::Mouse::Right) {
-            bool flagged = board.flag(x, y);
+            board.resetAll(x, y);
+            firstClick = { x, y };
+            std::cout << "Board seed " << board.getSeed() << ", first click at " << x << ", " << y << "\n";
         }
 
-        clicks++;
+        auto bomb = board.reveal(x, y);
+        record(Move::Reveal, x, y);
+
+        if (bomb)
+            lose();
+        else if (board.isWon())
+            win();
+    }
 
+    else if (move.action == Move::Flag) {
+        board.flag(x, y);
+        record(Move::Flag, x, y);
     }
 
+    clicks++;
 }
 
 // GAME STATE SYSTEM
@@ -201,6 +452,16 @@ inline void Minesweeper::lose()
     board.revealAll();
 }
 
+inline void Minesweeper::win()
+{
+    lastTime = getTimeSeconds();
+
+    state = GameState::WON;
+
+    // ON WIN
+    std::cout << "Cleared the board in " << lastTime << " seconds!\n";
+}
+
 
 inline void Minesweeper::reset()
 {
@@ -208,12 +469,58 @@ inline void Minesweeper::reset()
 
     clicks = 0;
     board.resetAll();
+
+    // Players tend to click the same place first
+    if (generator)
+        generator->prepare(firstClick.x, firstClick.y, board.getNextSeed());
+
+    record(Move::Reset);
 }
 
 inline void Minesweeper::start()
 {
     state = GameState::PLAYING;
     timer.restart();
+
+    record(Move::Start);
+
+    if (player)
+        player->start(board);
+}
+
+// PLAYER
+
+void Minesweeper::setPlayer(std::unique_ptr<Player> player)
+{
+    this->player = std::move(player);
+}
+
+// NO GUESSING
+
+void Minesweeper::setNoGuess(bool enabled)
+{
+    if (!enabled) {
+        generator = nullptr;
+        return;
+    }
+
+    generator = std::make_unique<Generator>(board.cols, board.rows, board.bombs);
+
+    firstClick = { (int) board.cols / 2, (int) board.rows / 2 };
+    generator->prepare(firstClick.x, firstClick.y, board.getNextSeed());
+}
+
+// JOURNAL
+
+void Minesweeper::setJournal(const std::string& path)
+{
+    journal = std::make_unique<Journal>(path, board.cols, board.rows, board.bombs);
+}
+
+void Minesweeper::record(Move::Action action, int x, int y)
+{
+    if (journal)
+        journal->record(action, x, y, board.getSeed());
 }
 
 bool Minesweeper::isPlaying() const
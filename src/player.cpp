@@ -0,0 +1,49 @@
+#include "../headers/player.hpp"
+
+void Player::start(const Minefield&)
+{
+}
+
+Player::Result Player::play(Minefield& board, int x, int y)
+{
+    Result result;
+
+    board.resetAll(x, y);
+    start(board);
+
+    board.open(x, y);
+    result.moves++;
+
+    while (!board.isWon()) {
+        auto move = getMove(board);
+
+        if (!move || !board.inBounds(move->x, move->y))
+            break;
+
+        result.moves++;
+
+        if (move->action == Move::Flag) {
+            // A flag on a discovered mine does nothing
+            if (board.flag(move->x, move->y))
+                break;
+        }
+
+        else if (move->action == Move::Reveal) {
+            std::size_t opened = board.open(move->x, move->y);
+            const Mine& mine = board.get(move->x, move->y);
+
+            if (!mine.flagged() && mine.bomb) {
+                result.lost = true;
+                break;
+            }
+
+            // A reveal that opens nothing would be made again forever
+            if (opened == 0)
+                break;
+        }
+    }
+
+    result.won = board.isWon();
+
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,580 @@
+#include "../headers/probabilities.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace
+{
+
+    /**
+     * The logarithm of the number of ways to pick k of n mines, which
+     * is negative infinity when they can't be picked
+     */
+    double logChoose(long long n, long long k)
+    {
+        if (k < 0 || k > n)
+            return -std::numeric_limits<double>::infinity();
+
+        return std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0);
+    }
+
+    /**
+     * Multiplies two polynomials given by their coefficients, scaling
+     * the result so that its largest coefficient is 1
+     */
+    std::vector<double> convolve(const std::vector<double>& a, const std::vector<double>& b)
+    {
+        std::vector<double> result(a.size() + b.size() - 1, 0.0);
+
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            for (std::size_t j = 0; j < b.size(); ++j)
+                result[i + j] += a[i] * b[j];
+        }
+
+        double largest = *std::max_element(result.begin(), result.end());
+
+        if (largest > 0) {
+            for (auto& value : result)
+                value /= largest;
+        }
+
+        return result;
+    }
+
+    /**
+     * Scales the arrangements of a layer so that the largest of them is
+     * 1, and returns the logarithm of what they were divided by
+     */
+    double normalize(std::vector<std::vector<double>>& arrangements)
+    {
+        double largest = 0;
+
+        for (const auto& counts : arrangements)
+            largest = std::max(largest, *std::max_element(counts.begin(), counts.end()));
+
+        if (largest <= 0)
+            return 0;
+
+        for (auto& counts : arrangements) {
+            for (auto& value : counts)
+                value /= largest;
+        }
+
+        return std::log(largest);
+    }
+
+    /**
+     * FNV-1a over the words of a shape
+     */
+    std::uint64_t hashShape(const std::vector<std::uint32_t>& shape)
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+
+        for (auto word : shape) {
+            hash ^= word;
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+}
+
+Probabilities::Probabilities(const Minefield& board) :
+    board { board },
+    probabilities(board.cols * board.rows, 0.0)
+{
+}
+
+/************
+ * COUNTING *
+ ************/
+
+Probabilities::Arrangements Probabilities::count(const std::vector<std::uint32_t>& shape, std::size_t size)
+{
+    // A shape is the number of mines and counts, then each count as its
+    // value, its length and its mines
+    struct Count
+    {
+        int value;
+        std::vector<std::size_t> mines;
+        std::size_t first, last;
+    };
+
+    std::vector<Count> counts(shape[1]);
+    std::vector<std::vector<std::size_t>> countsOf(size);
+
+    for (std::size_t i = 0, at = 2; i < counts.size(); ++i) {
+        counts[i].value = shape[at];
+
+        for (std::size_t j = 0; j < shape[at + 1]; ++j) {
+            counts[i].mines.push_back(shape[at + 2 + j]);
+            countsOf[shape[at + 2 + j]].push_back(i);
+        }
+
+        at += 2 + shape[at + 1];
+    }
+
+    // The mines are placed in breadth first order through the counts, so
+    // that few counts are open (started but not finished) at any time
+    std::vector<std::size_t> order, position(size, size);
+
+    for (std::size_t start = 0; start < size; ++start) {
+        if (position[start] != size)
+            continue;
+
+        position[start] = order.size();
+        order.push_back(start);
+
+        for (std::size_t next = order.size() - 1; next < order.size(); ++next) {
+            for (auto c : countsOf[order[next]]) {
+                for (auto mine : counts[c].mines) {
+                    if (position[mine] == size) {
+                        position[mine] = order.size();
+                        order.push_back(mine);
+                    }
+                }
+            }
+        }
+    }
+
+    for (auto& count : counts) {
+        count.first = size;
+        count.last = 0;
+
+        for (auto mine : count.mines) {
+            count.first = std::min(count.first, position[mine]);
+            count.last = std::max(count.last, position[mine]);
+        }
+    }
+
+    // How many mines of each count are placed after each position
+    std::vector<std::vector<std::pair<std::size_t, int>>> placing(size);
+
+    for (std::size_t c = 0; c < counts.size(); ++c) {
+        std::vector<std::size_t> positions;
+        for (auto mine : counts[c].mines)
+            positions.push_back(position[mine]);
+
+        std::sort(positions.begin(), positions.end());
+
+        for (std::size_t i = 0; i < positions.size(); ++i)
+            placing[positions[i]].push_back({ c, static_cast<int>(positions.size() - i - 1) });
+    }
+
+    // The counts that are open between the mines at i - 1 and i
+    std::vector<std::vector<std::size_t>> open(size + 1);
+
+    for (std::size_t c = 0; c < counts.size(); ++c) {
+        for (std::size_t i = counts[c].first + 1; i <= counts[c].last; ++i)
+            open[i].push_back(c);
+    }
+
+    // A state is the number of bombs each open count still needs. Each
+    // layer holds the arrangements of the mines before it by the state
+    // they leave and the number of bombs in them, and where each state
+    // goes when the next mine is empty or a bomb.
+    //
+    // A long component has more arrangements than a double holds, so 
+    // each layer is scaled so that its largest count is 1, and the
+    // logarithm of its scale is carried in `scale`.
+    struct Layer
+    {
+        std::vector<std::string> states;
+        std::vector<std::vector<double>> arrangements;
+        std::vector<std::array<int, 2>> next;
+        double scale = 0;
+    };
+
+    std::vector<Layer> layers(size + 1);
+    layers[0].states.push_back({});
+    layers[0].arrangements.push_back({ 1.0 });
+
+    std::vector<int> needs(counts.size());
+
+    for (std::size_t i = 0; i < size; ++i) {
+        Layer& layer = layers[i];
+        Layer& following = layers[i + 1];
+
+        std::unordered_map<std::string, int> found;
+
+        for (std::size_t s = 0; s < layer.states.size(); ++s) {
+            std::array<int, 2> next = { -1, -1 };
+
+            for (int value = 0; value <= 1; ++value) {
+                for (std::size_t j = 0; j < open[i].size(); ++j)
+                    needs[open[i][j]] = layer.states[s][j];
+
+                bool fits = true;
+
+                for (auto [ c, after ] : placing[i]) {
+                    if (counts[c].first == i)
+                        needs[c] = counts[c].value;
+
+                    needs[c] -= value;
+
+                    if (needs[c] < 0 || needs[c] > after)
+                        fits = false;
+                }
+
+                if (!fits)
+                    continue;
+
+                std::string state;
+                for (auto c : open[i + 1])
+                    state.push_back(static_cast<char>(needs[c]));
+
+                auto [ entry, added ] = found.insert({ state, static_cast<int>(following.states.size()) });
+
+                if (added) {
+                    following.states.push_back(state);
+                    following.arrangements.emplace_back(i + 2, 0.0);
+                }
+
+                auto& from = layer.arrangements[s];
+                auto& to = following.arrangements[entry->second];
+
+                for (std::size_t k = 0; k < from.size(); ++k)
+                    to[k + value] += from[k];
+
+                next[value] = entry->second;
+            }
+
+            layer.next.push_back(next);
+        }
+
+        following.scale = layer.scale + normalize(following.arrangements);
+    }
+
+    // The arrangements of the mines after each state, going backwards,
+    // scaled in the same way
+    std::vector<std::vector<std::vector<double>>> rest(size + 1);
+    std::vector<double> restScale(size + 1, 0.0);
+    rest[size].assign(layers[size].states.size(), { 1.0 });
+
+    for (std::size_t i = size; i-- > 0; ) {
+        rest[i].assign(layers[i].states.size(), std::vector<double>(size - i + 1, 0.0));
+
+        for (std::size_t s = 0; s < layers[i].states.size(); ++s) {
+            for (int value = 0; value <= 1; ++value) {
+                int next = layers[i].next[s][value];
+
+                if (next < 0)
+                    continue;
+
+                const auto& after = rest[i + 1][next];
+
+                for (std::size_t k = 0; k < after.size(); ++k)
+                    rest[i][s][k + value] += after[k];
+            }
+        }
+
+        restScale[i] = restScale[i + 1] + normalize(rest[i]);
+    }
+
+    Arrangements arrangements;
+    arrangements.size = size;
+    arrangements.shape = shape;
+
+    // A component always has a way to place its bombs, since it was 
+    // taken from a real board
+    arrangements.counts = layers[size].states.empty() ? 
+        std::vector<double>(size + 1, 0.0) : 
+        layers[size].arrangements[0];
+
+    arrangements.bombs.assign(arrangements.counts.size() * size, 0.0);
+
+    // The arrangements with a bomb on a mine join the arrangements before
+    // it with the arrangements after it. Those are scaled by the layers 
+    // on either side of the mine, and are brought to the scale of the 
+    // counts, which they are never far from, since both are about all
+    // the arrangements of the component.
+    for (std::size_t i = 0; i < size; ++i) {
+        double scale = std::exp(layers[i].scale + restScale[i + 1] - layers[size].scale);
+
+        for (std::size_t s = 0; s < layers[i].states.size(); ++s) {
+            int next = layers[i].next[s][1];
+
+            if (next < 0)
+                continue;
+
+            const auto& before = layers[i].arrangements[s];
+            const auto& after = rest[i + 1][next];
+
+            for (std::size_t a = 0; a < before.size(); ++a) {
+                if (before[a] == 0)
+                    continue;
+
+                for (std::size_t b = 0; b < after.size(); ++b)
+                    arrangements.bombs[(a + b + 1) * size + order[i]] += before[a] * after[b] * scale;
+            }
+        }
+    }
+
+    return arrangements;
+}
+
+/**********
+ * UPDATE *
+ **********/
+
+void Probabilities::update()
+{
+    updates++;
+
+    const std::size_t size = board.cols * board.rows;
+    probabilities.assign(size, 0.0);
+
+    // The hidden mines next to discovered mines are numbered in the
+    // order they are found, and every discovered mine next to them
+    // becomes a count over their numbers
+    std::vector<int> numbers(size, -1);
+    std::vector<std::size_t> frontier;
+
+    struct Count
+    {
+        int value;
+        std::size_t first, last;
+    };
+
+    std::vector<Count> counts;
+    std::vector<std::size_t> countMines;
+
+    long long knownBombs = 0, hidden = 0;
+
+    for (std::size_t y = 0; y < board.rows; ++y) {
+        for (std::size_t x = 0; x < board.cols; ++x) {
+            const Mine& mine = board.get(x, y);
+
+            if (!mine.discovered()) {
+                hidden++;
+                continue;
+            }
+
+            // Only a lost game has discovered bombs
+            if (mine.bomb) {
+                knownBombs++;
+                probabilities[y * board.cols + x] = 1.0;
+                continue;
+            }
+
+            int value = mine.neighbors;
+            std::size_t first = countMines.size();
+
+            for (int j = -1; j <= 1; ++j) {
+                for (int i = -1; i <= 1; ++i) {
+                    int xi = static_cast<int>(x) + i, yj = static_cast<int>(y) + j;
+
+                    if (!board.inBounds(xi, yj) || (i == 0 && j == 0))
+                        continue;
+
+                    const Mine& neighbor = board.get(xi, yj);
+                    std::size_t index = yj * board.cols + xi;
+
+                    if (neighbor.discovered()) {
+                        value -= neighbor.bomb;
+                        continue;
+                    }
+
+                    if (numbers[index] < 0) {
+                        numbers[index] = frontier.size();
+                        frontier.push_back(index);
+                    }
+
+                    countMines.push_back(numbers[index]);
+                }
+            }
+
+            if (countMines.size() > first)
+                counts.push_back({ value, first, countMines.size() });
+        }
+    }
+
+    // Mines that share a count are in the same component
+    std::vector<std::size_t> parents(frontier.size());
+    for (std::size_t i = 0; i < parents.size(); ++i)
+        parents[i] = i;
+
+    auto find = [&parents](std::size_t mine) {
+        while (parents[mine] != mine) {
+            parents[mine] = parents[parents[mine]];
+            mine = parents[mine];
+        }
+
+        return mine;
+    };
+
+    for (const auto& count : counts) {
+        for (std::size_t i = count.first + 1; i < count.last; ++i)
+            parents[find(countMines[i])] = find(countMines[count.first]);
+    }
+
+    // The counts and mines of each component, with the mines numbered
+    // again within the component
+    std::vector<int> componentOf(frontier.size(), -1), localNumbers(frontier.size(), -1);
+    std::vector<std::vector<std::size_t>> componentCounts, componentMines;
+
+    for (std::size_t c = 0; c < counts.size(); ++c) {
+        std::size_t root = find(countMines[counts[c].first]);
+
+        if (componentOf[root] < 0) {
+            componentOf[root] = componentCounts.size();
+            componentCounts.emplace_back();
+            componentMines.emplace_back();
+        }
+
+        auto component = componentOf[root];
+        componentCounts[component].push_back(c);
+
+        for (std::size_t i = counts[c].first; i < counts[c].last; ++i) {
+            std::size_t mine = countMines[i];
+
+            if (localNumbers[mine] < 0) {
+                localNumbers[mine] = componentMines[component].size();
+                componentMines[component].push_back(mine);
+            }
+        }
+    }
+
+    components = componentCounts.size();
+
+    // The arrangements of every component, from the cache or counted
+    std::vector<const Arrangements*> arrangements;
+
+    for (std::size_t component = 0; component < components; ++component) {
+        std::vector<std::uint32_t> shape;
+        shape.push_back(componentMines[component].size());
+        shape.push_back(componentCounts[component].size());
+
+        for (auto c : componentCounts[component]) {
+            shape.push_back(counts[c].value);
+            shape.push_back(counts[c].last - counts[c].first);
+
+            for (std::size_t i = counts[c].first; i < counts[c].last; ++i)
+                shape.push_back(localNumbers[countMines[i]]);
+        }
+
+        std::uint64_t hash = hashShape(shape);
+        auto cached = cache.find(hash);
+
+        if (cached != cache.end() && cached->second.shape == shape) {
+            hits++;
+        } else {
+            misses++;
+            cached = cache.insert_or_assign(hash, count(shape, componentMines[component].size())).first;
+        }
+
+        cached->second.used = updates;
+        arrangements.push_back(&cached->second);
+    }
+
+    // The bombs that are left are spread over the frontier and the
+    // hidden mines away from it, which can hold any of them
+    long long left = static_cast<long long>(board.bombs) - knownBombs;
+    long long away = hidden - static_cast<long long>(frontier.size());
+
+    // The weight of the mines away from the frontier holding all but
+    // `bombs` of the bombs that are left, relative to the largest one
+    double largest = -std::numeric_limits<double>::infinity();
+    for (long long bombs = 0; bombs <= left; ++bombs)
+        largest = std::max(largest, logChoose(away, left - bombs));
+
+    std::vector<double> awayWeights(frontier.size() + 1, 0.0);
+
+    for (std::size_t bombs = 0; bombs < awayWeights.size(); ++bombs) {
+        double weight = logChoose(away, left - static_cast<long long>(bombs));
+        awayWeights[bombs] = std::isinf(weight) ? 0.0 : std::exp(weight - largest);
+    }
+
+    // Arrangements of all the components before and after each component
+    std::vector<std::vector<double>> before(components + 1), after(components + 1);
+    before[0] = after[components] = { 1.0 };
+
+    for (std::size_t c = 0; c < components; ++c)
+        before[c + 1] = convolve(before[c], arrangements[c]->counts);
+
+    for (std::size_t c = components; c-- > 0; )
+        after[c] = convolve(after[c + 1], arrangements[c]->counts);
+
+    for (std::size_t c = 0; c < components; ++c) {
+        const Arrangements& component = *arrangements[c];
+        std::vector<double> others = convolve(before[c], after[c + 1]);
+
+        double total = 0;
+        std::vector<double> bombs(component.size, 0.0);
+
+        for (std::size_t k = 0; k < component.counts.size(); ++k) {
+            // The weight of every arrangement of the other components and
+            // of the mines away from the frontier, with k bombs in this one
+            double weight = 0;
+            for (std::size_t f = 0; f < others.size(); ++f)
+                weight += others[f] * awayWeights[k + f];
+
+            total += component.counts[k] * weight;
+
+            for (std::size_t mine = 0; mine < component.size; ++mine)
+                bombs[mine] += component.bombs[k * component.size + mine] * weight;
+        }
+
+        for (std::size_t mine = 0; mine < component.size; ++mine)
+            probabilities[frontier[componentMines[c][mine]]] = total > 0 ? bombs[mine] / total : 0.0;
+    }
+
+    // Every mine away from the frontier is as likely as the others
+    if (away > 0) {
+        double total = 0, bombs = 0;
+
+        const auto& all = before[components];
+
+        for (std::size_t f = 0; f < all.size(); ++f) {
+            double weight = all[f] * awayWeights[f];
+
+            total += weight;
+            bombs += weight * (left - static_cast<long long>(f)) / away;
+        }
+
+        double probability = total > 0 ? bombs / total : 0.0;
+
+        for (std::size_t index = 0; index < size; ++index) {
+            if (!board.get(index % board.cols, index / board.cols).discovered() && numbers[index] < 0)
+                probabilities[index] = probability;
+        }
+    }
+
+    // Components that weren't seen in a while are forgotten
+    if (cache.size() > 4 * components + 256) {
+        for (auto entry = cache.begin(); entry != cache.end(); ) {
+            if (entry->second.used != updates)
+                entry = cache.erase(entry);
+            else
+                ++entry;
+        }
+    }
+}
+
+/***********
+ * GETTERS *
+ ***********/
+
+double Probabilities::get(int x, int y) const
+{
+    return probabilities[y * board.cols + x];
+}
+
+std::size_t Probabilities::getComponentCount() const
+{
+    return components;
+}
+
+std::size_t Probabilities::getCacheHits() const
+{
+    return hits;
+}
+
+std::size_t Probabilities::getCacheMisses() const
+{
+    return misses;
+}
\ No newline at end of file
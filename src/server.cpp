@@ -0,0 +1,343 @@
+#include "../headers/server.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+namespace
+{
+
+    // The most words that a request can have
+    const std::size_t MAX_WORDS = 6;
+
+    bool isSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    /**
+     * Splits a line into the words between its spaces. Returns the number
+     * of words, or one more than `most` if there are more of them.
+     */
+    std::size_t split(std::string_view line, std::string_view* words, std::size_t most)
+    {
+        std::size_t count = 0, i = 0;
+
+        while (i < line.size()) {
+            while (i < line.size() && isSpace(line[i]))
+                i++;
+
+            if (i == line.size())
+                break;
+
+            std::size_t start = i;
+
+            while (i < line.size() && !isSpace(line[i]))
+                i++;
+
+            if (count == most)
+                return most + 1;
+
+            words[count++] = line.substr(start, i - start);
+        }
+
+        return count;
+    }
+
+    bool parse(std::string_view word, std::uint64_t& value)
+    {
+        auto [ end, error ] = std::from_chars(word.data(), word.data() + word.size(), value);
+        return error == std::errc() && end == word.data() + word.size();
+    }
+
+    bool isGameCommand(std::string_view command)
+    {
+        return command == "open" || command == "flag" || command == "restart" ||
+               command == "view" || command == "close";
+    }
+
+    char getSymbol(const Mine& mine)
+    {
+        if (mine.flagged())
+            return 'F';
+        if (!mine.discovered())
+            return '.';
+        if (mine.bomb)
+            return '*';
+
+        return '0' + mine.neighbors;
+    }
+
+}
+
+Server::Game::Game(std::size_t cols, std::size_t rows, std::size_t bombs) :
+    board { cols, rows, bombs }
+{
+}
+
+Server::Server(std::size_t threads) :
+    pool { threads }
+{
+    shards.resize(pool.getThreadCount() * SHARDS_PER_THREAD);
+}
+
+std::size_t Server::getGameCount() const
+{
+    std::size_t count = 0;
+
+    for (const Shard& shard : shards)
+        count += shard.live;
+
+    return count;
+}
+
+std::size_t Server::getThreadCount() const
+{
+    return pool.getThreadCount();
+}
+
+/************
+ * BATCHING *
+ ************/
+
+void Server::handle(std::vector<Request>& requests)
+{
+    for (Shard& shard : shards)
+        shard.requests.clear();
+
+    std::size_t busy = 0;
+
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        std::size_t shard, slot;
+
+        if (route(requests[i], shard, slot)) {
+            busy += shards[shard].requests.empty();
+            shards[shard].requests.push_back({ i, slot });
+        }
+    }
+
+    for (std::size_t s = 0; s < shards.size(); ++s) {
+        if (shards[s].requests.empty())
+            continue;
+
+        auto task = [this, s, &requests](std::size_t) {
+            for (auto [ index, slot ] : shards[s].requests)
+                play(s, slot, requests[index]);
+        };
+
+        // A batch of a single shard isn't worth waking a thread for
+        if (busy == 1)
+            task(0);
+        else
+            pool.submit(task);
+    }
+
+    if (busy > 1)
+        pool.wait();
+}
+
+bool Server::route(Request& request, std::size_t& shard, std::size_t& slot)
+{
+    std::string_view words[2];
+    split(request.line, words, 2);
+
+    if (words[0] == "new") {
+        shard = nextShard;
+        nextShard = (nextShard + 1) % shards.size();
+
+        // The slot is filled by the task of the shard
+        Shard& owner = shards[shard];
+
+        if (!owner.freed.empty()) {
+            slot = owner.freed.back();
+            owner.freed.pop_back();
+        }
+        else {
+            slot = owner.games.size();
+            owner.games.emplace_back();
+        }
+
+        return true;
+    }
+
+    std::uint64_t id;
+
+    if (words[0].empty())
+        request.response = "error empty request";
+    else if (!isGameCommand(words[0]))
+        request.response = "error unknown command " + std::string(words[0]);
+    else if (!parse(words[1], id))
+        request.response = "error expected a game id";
+    else if (id / shards.size() >= shards[id % shards.size()].games.size())
+        request.response = "error no game " + std::to_string(id);
+    else {
+        shard = id % shards.size();
+        slot = id / shards.size();
+
+        return true;
+    }
+
+    return false;
+}
+
+/***********
+ * PLAYING *
+ ***********/
+
+void Server::play(std::size_t s, std::size_t slot, Request& request)
+{
+    Shard& shard = shards[s];
+    std::string& response = request.response;
+
+    std::string_view words[MAX_WORDS];
+    std::size_t count = split(request.line, words, MAX_WORDS);
+
+    std::string_view command = words[0];
+    std::uint64_t numbers[MAX_WORDS - 1] = {};
+
+    try {
+        if (count > MAX_WORDS)
+            throw std::runtime_error("too many words");
+
+        for (std::size_t i = 1; i < count; ++i) {
+            if (!parse(words[i], numbers[i - 1]))
+                throw std::runtime_error("expected a number instead of " + std::string(words[i]));
+        }
+
+        if (command == "new") {
+            std::uint64_t cols = numbers[0], rows = numbers[1], bombs = numbers[2];
+
+            if (count < 4 || count > 5)
+                throw std::runtime_error("new takes <cols> <rows> <bombs> [<seed>]");
+            if (cols == 0 || rows == 0 || cols > MAX_MINES || rows > MAX_MINES || cols * rows > MAX_MINES)
+                throw std::runtime_error("a game has 1 to " + std::to_string(MAX_MINES) + " mines");
+
+            // The first open has to have a mine without a bomb
+            if (bombs >= cols * rows)
+                throw std::runtime_error("a game has fewer bombs than mines");
+
+            auto game = std::make_unique<Game>(cols, rows, bombs);
+
+            if (count == 5)
+                game->board.setSeed(numbers[3]);
+
+            shard.games[slot] = std::move(game);
+            shard.live++;
+
+            response = "game " + std::to_string(slot * shards.size() + s);
+            return;
+        }
+
+        if (!shard.games[slot])
+            throw std::runtime_error("no game " + std::string(words[1]));
+
+        Game& game = *shard.games[slot];
+        Minefield& board = game.board;
+
+        if (command == "close") {
+            shard.games[slot].reset();
+            shard.freed.push_back(slot);
+            shard.live--;
+
+            response = "closed";
+            return;
+        }
+
+        if (command == "view") {
+            std::uint64_t x = numbers[1], y = numbers[2], w = numbers[3], h = numbers[4];
+
+            if (count != 6)
+                throw std::runtime_error("view takes <id> <x> <y> <w> <h>");
+            if (x >= board.cols || y >= board.rows)
+                throw std::runtime_error("out of bounds");
+
+            // The view is clipped to the board
+            w = std::min<std::uint64_t>(w, board.cols - x);
+            h = std::min<std::uint64_t>(h, board.rows - y);
+
+            if (w * h > MAX_VIEW)
+                throw std::runtime_error("a view has at most " + std::to_string(MAX_VIEW) + " mines");
+
+            response.reserve(5 + w * h);
+            response = "view ";
+
+            for (std::uint64_t j = y; j < y + h; ++j) {
+                for (std::uint64_t i = x; i < x + w; ++i)
+                    response += getSymbol(board.get(i, j));
+            }
+
+            return;
+        }
+
+        std::size_t opened = 0;
+
+        if (command == "restart") {
+            if (count < 2 || count > 3)
+                throw std::runtime_error("restart takes <id> [<seed>]");
+
+            if (count == 3)
+                board.setSeed(numbers[1]);
+
+            board.resetAll();
+            game.started = false;
+            game.outcome = Outcome::Playing;
+        }
+
+        else {
+            std::uint64_t x = numbers[1], y = numbers[2];
+
+            if (count != 4)
+                throw std::runtime_error(std::string(command) + " takes <id> <x> <y>");
+            if (x >= board.cols || y >= board.rows)
+                throw std::runtime_error("out of bounds");
+
+            // A game that is over only answers with how it ended
+            if (game.outcome != Outcome::Playing) {
+            }
+
+            else if (command == "flag")
+                board.flag(x, y);
+
+            else {
+                // The first open places the bombs around it
+                if (!game.started) {
+                    board.resetAll(x, y);
+                    game.started = true;
+                }
+
+                const Mine& mine = board.get(x, y);
+
+                if (mine.bomb && !mine.flagged()) {
+                    game.outcome = Outcome::Lost;
+                    board.revealAll();
+                }
+                else {
+                    opened = board.open(x, y);
+
+                    if (board.isWon())
+                        game.outcome = Outcome::Won;
+                }
+            }
+        }
+
+        response =
+            game.outcome == Outcome::Won ? "won " :
+            game.outcome == Outcome::Lost ? "lost " :
+            "playing ";
+
+        response += std::to_string(opened);
+        response += ' ';
+        response += std::to_string(board.getSafeLeft());
+        response += ' ';
+        response += std::to_string(board.getFlags());
+    }
+
+    catch (const std::exception& error) {
+        // A new game that failed gives its slot back
+        if (command == "new")
+            shard.freed.push_back(slot);
+
+        response = "error ";
+        response += error.what();
+    }
+}
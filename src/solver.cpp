@@ -0,0 +1,225 @@
+#include "../headers/solver.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+
+    Move makeMove(Move::Action action, std::size_t index, std::size_t cols)
+    {
+        Move move {};
+        move.action = action;
+        move.x = index % cols;
+        move.y = index / cols;
+
+        return move;
+    }
+
+}
+
+Solver::Solver(bool guessing) : 
+    guessing { guessing }
+{
+}
+
+void Solver::start(const Minefield&)
+{
+    moves.clear();
+}
+
+std::size_t Solver::getGuesses() const
+{
+    return guesses;
+}
+
+bool Solver::isUseful(const Minefield& board, const Move& move)
+{
+    const Mine& mine = board.get(move.x, move.y);
+    return !mine.discovered() && !mine.flagged();
+}
+
+std::optional<Move> Solver::getMove(const Minefield& board)
+{
+    // Moves that were worked out before may have been opened since
+    while (!moves.empty()) {
+        Move move = moves.back();
+        moves.pop_back();
+
+        if (isUseful(board, move))
+            return move;
+    }
+
+    bool guessed = false;
+    auto move = solve(board, guessed);
+
+    while (!moves.empty()) {
+        Move move = moves.back();
+        moves.pop_back();
+
+        if (isUseful(board, move))
+            return move;
+    }
+
+    if (!move || (guessed && !guessing))
+        return std::nullopt;
+
+    guesses += guessed;
+    return move;
+}
+
+std::optional<Move> Solver::solve(const Minefield& board, bool& guessed)
+{
+    const std::size_t cols = board.cols, size = board.cols * board.rows;
+
+    counts.clear();
+    countOf.assign(size, -1);
+
+    std::size_t discovered = 0, flags = 0, hidden = 0;
+
+    for (std::size_t index = 0; index < size; ++index) {
+        int x = index % cols, y = index / cols;
+        const Mine& mine = board.get(x, y);
+
+        if (mine.flagged()) {
+            flags++;
+            continue;
+        }
+
+        if (!mine.discovered()) {
+            hidden++;
+            continue;
+        }
+
+        discovered++;
+
+        Count count { static_cast<int>(mine.neighbors), {} };
+
+        // The neighbors are visited in order, so the hidden mines are sorted
+        for (int j = -1; j <= 1; ++j) {
+            for (int i = -1; i <= 1; ++i) {
+                if (!board.inBounds(x + i, y + j) || (i == 0 && j == 0))
+                    continue;
+
+                const Mine& neighbor = board.get(x + i, y + j);
+
+                if (neighbor.flagged())
+                    count.bombs--;
+                else if (!neighbor.discovered())
+                    count.hidden.push_back((y + j) * cols + (x + i));
+            }
+        }
+
+        if (!count.hidden.empty()) {
+            countOf[index] = counts.size();
+            counts.push_back(std::move(count));
+        }
+    }
+
+    if (hidden == 0)
+        return std::nullopt;
+
+    // The first reveal of a game is always safe
+    if (discovered == 0)
+        return makeMove(Move::Reveal, (board.rows / 2) * cols + cols / 2, cols);
+
+    // A count with no bombs left, or only bombs left
+    for (const auto& count : counts) {
+        if (count.bombs == 0) {
+            for (auto index : count.hidden)
+                moves.push_back(makeMove(Move::Reveal, index, cols));
+        } else if (count.bombs == static_cast<int>(count.hidden.size())) {
+            for (auto index : count.hidden)
+                moves.push_back(makeMove(Move::Flag, index, cols));
+        }
+    }
+
+    if (!moves.empty())
+        return std::nullopt;
+
+    // A count whose hidden mines are all around another count, which 
+    // can only be a count within two mines of it
+    std::vector<std::size_t> difference;
+
+    for (std::size_t index = 0; index < size; ++index) {
+        if (countOf[index] < 0)
+            continue;
+
+        const Count& inner = counts[countOf[index]];
+        int x = index % cols, y = index / cols;
+
+        for (int j = -2; j <= 2; ++j) {
+            for (int i = -2; i <= 2; ++i) {
+                if (!board.inBounds(x + i, y + j) || (i == 0 && j == 0))
+                    continue;
+
+                int other = countOf[(y + j) * cols + (x + i)];
+
+                if (other < 0)
+                    continue;
+
+                const Count& outer = counts[other];
+
+                if (outer.hidden.size() <= inner.hidden.size())
+                    continue;
+
+                if (!std::includes(outer.hidden.begin(), outer.hidden.end(), inner.hidden.begin(), inner.hidden.end()))
+                    continue;
+
+                difference.clear();
+                std::set_difference(
+                    outer.hidden.begin(), outer.hidden.end(), 
+                    inner.hidden.begin(), inner.hidden.end(), 
+                    std::back_inserter(difference)
+                );
+
+                int bombs = outer.bombs - inner.bombs;
+
+                if (bombs == 0) {
+                    for (auto mine : difference)
+                        moves.push_back(makeMove(Move::Reveal, mine, cols));
+                } else if (bombs == static_cast<int>(difference.size())) {
+                    for (auto mine : difference)
+                        moves.push_back(makeMove(Move::Flag, mine, cols));
+                }
+            }
+        }
+    }
+
+    if (!moves.empty())
+        return std::nullopt;
+
+    // Nothing is settled, so guess the mine with the lowest chance of
+    // being a bomb. The chance of a mine next to counts is guessed as 
+    // the highest share of bombs of the counts, and the chance of the 
+    // other mines as the share of the bombs left on the board.
+    std::vector<float> chances(size, -1.0f);
+
+    for (const auto& count : counts) {
+        float chance = count.bombs / (float) count.hidden.size();
+
+        for (auto index : count.hidden)
+            chances[index] = std::max(chances[index], chance);
+    }
+
+    float elsewhere = ((float) board.bombs - flags) / hidden;
+    float lowest = 2.0f;
+    std::size_t best = 0;
+
+    for (std::size_t index = 0; index < size; ++index) {
+        const Mine& mine = board.get(index % cols, index / cols);
+
+        if (mine.discovered() || mine.flagged())
+            continue;
+
+        float chance = chances[index] < 0 ? elsewhere : chances[index];
+
+        if (chance < lowest) {
+            lowest = chance;
+            best = index;
+        }
+    }
+
+    guessed = true;
+    return makeMove(Move::Reveal, best, cols);
+}
\ No newline at end of file
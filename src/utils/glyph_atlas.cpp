@@ -0,0 +1,65 @@
+#include "../../headers/utils/glyph_atlas.hpp"
+#include "../../headers/utils/font_loader.hpp"
+#include "../../headers/utils/utils.hpp"
+
+#include <memory>
+
+sf::FloatRect GlyphAtlas::Atlas::getRect(char glyph) const
+{
+    auto index = GLYPHS.find(glyph);
+
+    if (index == std::string::npos)
+        return {};
+
+    return sf::FloatRect(
+        index * cellSize.x * 1.0f, 0.0f,
+        cellSize.x * 1.0f, cellSize.y * 1.0f
+    );
+}
+
+GlyphAtlas::AtlasLoad GlyphAtlas::load(const std::string &path, sf::Vector2u cellSize)
+{
+    // CACHE
+    static std::unique_ptr<Atlas> ATLAS;
+    static std::string ATLAS_PATH;
+
+    // ALGORITHM
+
+    if (cellSize.x == 0 || cellSize.y == 0)
+        return std::nullopt;
+
+    bool cached = ATLAS && ATLAS_PATH == path && ATLAS->cellSize == cellSize;
+
+    if (cached)
+        return std::cref(*ATLAS);
+
+    auto fontLoad = FontLoader::load(path);
+
+    if (!fontLoad.has_value())
+        return std::nullopt;
+
+    auto atlas = std::make_unique<Atlas>();
+    atlas->cellSize = cellSize;
+
+    if (!atlas->texture.create(cellSize.x * GLYPHS.size(), cellSize.y))
+        return std::nullopt;
+
+    atlas->texture.clear(sf::Color::Transparent);
+
+    for (std::size_t i = 0; i < GLYPHS.size(); ++i) {
+        // Same placement as the text of a mine drawn on its own
+        atlas->texture.draw(Utils::getText(
+            std::string(1, GLYPHS[i]),
+            *fontLoad,
+            cellSize.y,
+            sf::Color::White,
+            { i * cellSize.x * 1.0f, -0.2f * cellSize.y }));
+    }
+
+    atlas->texture.display();
+
+    ATLAS = std::move(atlas);
+    ATLAS_PATH = path;
+
+    return std::cref(*ATLAS);
+}
\ No newline at end of file
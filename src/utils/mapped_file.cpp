@@ -0,0 +1,73 @@
+#include "../../headers/utils/mapped_file.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& path)
+{
+    int file = ::open(path.c_str(), O_RDONLY);
+
+    if (file < 0)
+        throw std::runtime_error("Could not open " + path);
+
+    struct stat info;
+
+    if (::fstat(file, &info) != 0 || info.st_size == 0) {
+        ::close(file);
+        throw std::runtime_error("Could not read the size of " + path);
+    }
+
+    size = static_cast<std::size_t>(info.st_size);
+
+    // A private mapping can be written to, and the pages that are
+    // written to are copied instead of changing the file
+    void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+
+    // The mapping keeps its own reference to the file
+    ::close(file);
+
+    if (mapping == MAP_FAILED)
+        throw std::runtime_error("Could not map " + path);
+
+    data = static_cast<char*>(mapping);
+}
+
+MappedFile::MappedFile(MappedFile&& other) : 
+    data { std::exchange(other.data, nullptr) },
+    size { std::exchange(other.size, 0) }
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other)
+{
+    if (this != &other) {
+        if (data)
+            ::munmap(data, size);
+
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+    }
+
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    if (data)
+        ::munmap(data, size);
+}
+
+char* MappedFile::getData() const
+{
+    return data;
+}
+
+std::size_t MappedFile::getSize() const
+{
+    return size;
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "../../headers/utils/thread_pool.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(std::size_t count)
+{
+    count = std::max<std::size_t>(count, 1);
+
+    for (std::size_t i = 0; i < count; ++i)
+        queues.push_back(std::make_unique<Queue>());
+
+    for (std::size_t i = 0; i < count; ++i)
+        threads.emplace_back([this, i] { run(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    wait();
+
+    {
+        std::lock_guard<std::mutex> lock { sleeping };
+        stopping = true;
+    }
+
+    wake.notify_all();
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+void ThreadPool::submit(Task task)
+{
+    Queue& queue = *queues[next++ % queues.size()];
+
+    pending++;
+
+    {
+        std::lock_guard<std::mutex> lock { queue.mutex };
+        queue.tasks.push_back(std::move(task));
+    }
+
+    // Taking the lock keeps a thread from missing the wake up between 
+    // seeing empty queues and going to sleep
+    {
+        std::lock_guard<std::mutex> lock { sleeping };
+        queued++;
+    }
+
+    wake.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock { sleeping };
+    finished.wait(lock, [this] { return pending == 0; });
+}
+
+std::size_t ThreadPool::getThreadCount() const
+{
+    return threads.size();
+}
+
+bool ThreadPool::take(std::size_t thread, Task& task)
+{
+    // The newest task of its own queue
+    {
+        Queue& queue = *queues[thread];
+        std::lock_guard<std::mutex> lock { queue.mutex };
+
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            queued--;
+
+            return true;
+        }
+    }
+
+    // The oldest task of another queue
+    for (std::size_t i = 1; i < queues.size(); ++i) {
+        Queue& queue = *queues[(thread + i) % queues.size()];
+        std::lock_guard<std::mutex> lock { queue.mutex };
+
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            queued--;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::run(std::size_t thread)
+{
+    Task task;
+
+    while (true) {
+        if (take(thread, task)) {
+            task(thread);
+            task = nullptr;
+
+            if (--pending == 0) {
+                std::lock_guard<std::mutex> lock { sleeping };
+                finished.notify_all();
+            }
+
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock { sleeping };
+        wake.wait(lock, [this] { return stopping || queued > 0; });
+
+        if (stopping && queued == 0)
+            return;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../headers/analytics.hpp"
+
+/**
+ * Checks the metrics of `Analytics` against a flood fill of every opening
+ * on random boards, and that histograms only grow as far as their values.
+ * Prints every check that fails, and exits with 1 if any did.
+ */
+
+int failures = 0;
+
+void check(bool condition, const std::string& name)
+{
+    if (!condition) {
+        std::cout << "FAILED: " << name << "\n";
+        failures++;
+    }
+}
+
+/**
+ * Works out the metrics of a board the slow way: each opening is filled
+ * mine by mine, and each number looks for an opening around it
+ */
+Analytics::Metrics floodFill(const Minefield& board)
+{
+    const int cols = board.cols, rows = board.rows;
+
+    auto isOpening = [&](int x, int y) {
+        const Mine& mine = board.get(x, y);
+        return !mine.bomb && mine.neighbors == 0;
+    };
+
+    Analytics::Metrics metrics;
+    std::vector<bool> seen(cols * rows, false);
+    std::vector<int> stack;
+
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < cols; ++x) {
+            if (board.get(x, y).bomb)
+                continue;
+
+            if (isOpening(x, y)) {
+                if (seen[y * cols + x])
+                    continue;
+
+                metrics.openings++;
+                seen[y * cols + x] = true;
+                stack.push_back(y * cols + x);
+
+                while (!stack.empty()) {
+                    int index = stack.back();
+                    stack.pop_back();
+
+                    for (int j = -1; j <= 1; ++j) {
+                        for (int i = -1; i <= 1; ++i) {
+                            int xi = index % cols + i, yj = index / cols + j;
+
+                            if (board.inBounds(xi, yj) && isOpening(xi, yj) && !seen[yj * cols + xi]) {
+                                seen[yj * cols + xi] = true;
+                                stack.push_back(yj * cols + xi);
+                            }
+                        }
+                    }
+                }
+
+                continue;
+            }
+
+            bool nextToOpening = false;
+
+            for (int j = -1; j <= 1; ++j) {
+                for (int i = -1; i <= 1; ++i)
+                    nextToOpening |= board.inBounds(x + i, y + j) && isOpening(x + i, y + j);
+            }
+
+            metrics.isolated += !nextToOpening;
+        }
+    }
+
+    metrics.bbbv = metrics.openings + metrics.isolated;
+
+    return metrics;
+}
+
+/**
+ * Analyzes random boards of many shapes and densities, some reset around
+ * a first click, and compares them with the flood fill
+ */
+void testRandomBoards()
+{
+    struct Size { std::size_t cols, rows, bombs; };
+
+    const Size sizes[] = {
+        { 8, 8, 10 }, { 30, 16, 99 }, { 50, 1, 5 }, { 1, 40, 4 }, { 64, 64, 300 },
+        { 9, 9, 0 }, { 5, 5, 25 }, { 100, 70, 600 }, { 16, 16, 40 }, { 33, 7, 2 }
+    };
+
+    Random::Engine engine { 1 };
+    Analytics analytics;
+
+    bool openings = true, isolated = true, bbbv = true;
+
+    for (auto size : sizes) {
+        Minefield board { size.cols, size.rows, size.bombs };
+
+        for (int game = 0; game < 300; ++game) {
+            board.setSeed(engine());
+
+            if (game % 2)
+                board.resetAll();
+            else
+                board.resetAll(engine() % size.cols, engine() % size.rows);
+
+            auto metrics = analytics.analyze(board);
+            auto expected = floodFill(board);
+
+            openings = openings && metrics.openings == expected.openings;
+            isolated = isolated && metrics.isolated == expected.isolated;
+            bbbv = bbbv && metrics.bbbv == expected.bbbv;
+        }
+    }
+
+    check(openings, "the openings are those of a flood fill");
+    check(isolated, "the isolated numbers are those of a flood fill");
+    check(bbbv, "the 3BV is the openings and the isolated numbers");
+}
+
+// The counts of a histogram end at the largest value that was added
+void testHistograms()
+{
+    Analytics::Histograms histograms { 1000, 1000, 100000 };
+
+    check(histograms.bbbv.empty(), "a histogram doesn't count anything before a board is added");
+
+    Analytics::Metrics metrics;
+    metrics.bbbv = 7;
+    metrics.openings = 2;
+    metrics.isolated = 5;
+
+    histograms.add(metrics);
+    metrics.bbbv = 3;
+    histograms.add(metrics);
+
+    Analytics::Histograms total { 1000, 1000, 100000 };
+    total.add(histograms);
+    total.add(histograms);
+
+    check(total.bbbv.size() == 8 && total.openings.size() == 3 && total.isolated.size() == 6, "a histogram ends at its largest value");
+    check(total.boards == 4 && total.bbbv[7] == 2 && total.bbbv[3] == 2 && total.isolated[5] == 4, "histograms add up");
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 tests/analytics.cpp src/mine.cpp src/minefield.cpp src/analytics.cpp src/utils/mapped_file.cpp
+    */
+
+    testRandomBoards();
+    testHistograms();
+
+    if (failures > 0)
+        return 1;
+
+    std::cout << "All checks passed\n";
+    return 0;
+}
+/////////
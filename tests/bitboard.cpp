@@ -0,0 +1,139 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../headers/bitboard.hpp"
+#include "../headers/minefield.hpp"
+
+/**
+ * Checks that a `Bitboard` plays the same as a `Minefield`: the same
+ * seed places the same bombs, and every open and flag opens the same
+ * mines. Prints every check that fails, and exits with 1 if any did.
+ */
+
+int failures = 0;
+
+void check(bool condition, const std::string& name)
+{
+    if (!condition) {
+        std::cout << "FAILED: " << name << "\n";
+        failures++;
+    }
+}
+
+bool sameMines(const Bitboard& board, const Minefield& expected)
+{
+    for (std::size_t y = 0; y < board.rows; ++y) {
+        for (std::size_t x = 0; x < board.cols; ++x) {
+            const Mine& mine = expected.get(x, y);
+
+            if (board.bomb(x, y) != bool(mine.bomb) ||
+                board.discovered(x, y) != mine.discovered() ||
+                board.flagged(x, y) != mine.flagged())
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * An opening only spreads from the mines that the reveal opened, so a
+ * mine next to an older opening stays hidden if a flag cuts it off from
+ * the mine that was clicked
+ */
+void testOldOpening()
+{
+    Bitboard board { 7, 1, 0 };
+    Minefield expected { 7, 1, 0 };
+
+    for (int x : { 4, 3 }) {
+        board.flag(x, 0);
+        expected.flag(x, 0);
+    }
+
+    for (int x : { 6, 4 }) {
+        board.open(x, 0);
+        expected.open(x, 0);
+    }
+
+    board.flag(4, 0);
+    expected.flag(4, 0);
+
+    check(board.open(1, 0) == 3 && expected.open(1, 0) == 3, "an opening stops at a flag next to an older opening");
+    check(sameMines(board, expected), "an opening doesn't spread from an older opening");
+}
+
+/**
+ * Plays the same random opens and flags on both boards. The flags are
+ * also taken away again, so that openings are cut by flags, partly
+ * opened, and then opened from another mine.
+ */
+void testRandomGames()
+{
+    struct Size { std::size_t cols, rows, bombs; };
+
+    const Size sizes[] = { { 7, 1, 0 }, { 9, 9, 10 }, { 30, 16, 99 }, { 70, 5, 20 }, { 1, 50, 3 }, { 130, 90, 400 } };
+
+    Random::Engine engine { 7 };
+    bool placed = true, opened = true, same = true;
+
+    for (auto size : sizes) {
+        Bitboard board { size.cols, size.rows, size.bombs };
+        Minefield expected { size.cols, size.rows, size.bombs };
+
+        for (std::uint64_t game = 0; game < 500; ++game) {
+            board.setSeed(game);
+            board.resetAll();
+            expected.setSeed(game);
+            expected.resetAll();
+
+            placed = placed && sameMines(board, expected);
+
+            std::vector<std::pair<int, int>> flagged;
+
+            for (int move = 0; move < 40; ++move) {
+                int x = engine() % size.cols, y = engine() % size.rows;
+                int kind = engine() % 6;
+
+                if (kind < 3)
+                    opened = opened && board.open(x, y) == expected.open(x, y);
+                else if (kind < 5) {
+                    board.flag(x, y);
+                    expected.flag(x, y);
+                    flagged.push_back({ x, y });
+                }
+                else if (!flagged.empty()) {
+                    auto [ fx, fy ] = flagged[engine() % flagged.size()];
+                    board.flag(fx, fy);
+                    expected.flag(fx, fy);
+                }
+            }
+
+            same = same && sameMines(board, expected);
+        }
+    }
+
+    check(placed, "a seed places the same bombs on both boards");
+    check(opened, "an open opens as many mines on both boards");
+    check(same, "both boards open the same mines");
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 tests/bitboard.cpp src/mine.cpp src/minefield.cpp src/bitboard.cpp src/utils/mapped_file.cpp
+    */
+
+    testOldOpening();
+    testRandomGames();
+
+    if (failures > 0)
+        return 1;
+
+    std::cout << "All checks passed\n";
+    return 0;
+}
+/////////
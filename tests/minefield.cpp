@@ -0,0 +1,368 @@
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../headers/minefield.hpp"
+
+/**
+ * Checks the counters of a `Minefield` against the moves that made them.
+ * Prints every check that fails, and exits with 1 if any did.
+ */
+
+int failures = 0;
+
+void check(bool condition, const std::string& name)
+{
+    if (!condition) {
+        std::cout << "FAILED: " << name << "\n";
+        failures++;
+    }
+}
+
+// The first bomb of a board, which a lost game clicks
+std::pair<int, int> findBomb(const Minefield& board)
+{
+    for (std::size_t y = 0; y < board.rows; ++y) {
+        for (std::size_t x = 0; x < board.cols; ++x) {
+            if (board.get(x, y).bomb)
+                return { x, y };
+        }
+    }
+
+    return { -1, -1 };
+}
+
+void testLoss()
+{
+    Minefield board { 9, 9, 10 };
+    board.setSeed(1);
+    board.resetAll(4, 4);
+    board.open(4, 4);
+
+    auto [ x, y ] = findBomb(board);
+    std::size_t safeLeft = board.getSafeLeft();
+
+    check(board.reveal(x, y), "clicking a bomb loses");
+
+    board.revealAll();
+
+    check(!board.isWon(), "a lost game isn't won once it is revealed");
+    check(board.getSafeLeft() == safeLeft, "revealing doesn't open the safe mines that are left");
+}
+
+void testGiveUp()
+{
+    Minefield board { 16, 16, 40 };
+    board.setSeed(2);
+    board.resetAll(8, 8);
+    board.open(8, 8);
+
+    auto [ x, y ] = findBomb(board);
+    board.flag(x, y);
+
+    std::size_t safeLeft = board.getSafeLeft();
+
+    board.revealAll();
+
+    check(!board.isWon(), "a game that was given up isn't won");
+    check(board.getSafeLeft() == safeLeft, "giving up keeps the safe mines that are left");
+    check(board.getFlags() == 1 && board.getCorrectFlags() == 1, "giving up keeps the flags");
+}
+
+void testLoadedLoss()
+{
+    const char * path = "test-minefield.bin";
+
+    Minefield board { 30, 16, 99 };
+    board.setSeed(3);
+    board.resetAll(15, 8);
+    board.open(15, 8);
+
+    std::size_t safeLeft = board.getSafeLeft();
+    board.save(path);
+
+    // A loaded board counts its mines the first time it is asked to
+    Minefield loaded = Minefield::load(path);
+    loaded.revealAll();
+
+    check(!loaded.isWon(), "a loaded game isn't won once it is revealed");
+    check(loaded.getSafeLeft() == safeLeft, "a loaded game counts its mines before they are revealed");
+
+    std::remove(path);
+}
+
+/**
+ * A seed places the same bombs with every standard library, so these are
+ * the bombs of a seed on any platform
+ */
+void testSeededBombs()
+{
+    Minefield board { 9, 9, 10 };
+    board.setSeed(1);
+    board.resetAll();
+
+    const std::vector<std::size_t> expected = { 5, 11, 29, 30, 37, 42, 44, 50, 52, 69 };
+    std::vector<std::size_t> placed;
+
+    for (std::size_t index = 0; index < board.cols * board.rows; ++index) {
+        if (board.get(index % board.cols, index / board.cols).bomb)
+            placed.push_back(index);
+    }
+
+    check(placed == expected, "a seed places the same bombs everywhere");
+}
+
+void testWin()
+{
+    Minefield board { 9, 9, 10 };
+    board.setSeed(4);
+    board.resetAll(0, 0);
+
+    for (std::size_t y = 0; y < board.rows; ++y) {
+        for (std::size_t x = 0; x < board.cols; ++x) {
+            if (!board.get(x, y).bomb)
+                board.open(x, y);
+        }
+    }
+
+    check(board.isWon(), "opening every safe mine wins");
+
+    board.revealAll();
+
+    check(board.isWon(), "a won game stays won once it is revealed");
+}
+
+// Opens mine by mine with a stack, the way `open` spreads an opening
+std::size_t spread(Minefield& board, int x, int y)
+{
+    auto canOpen = [](const Mine& mine) {
+        return !mine.discovered() && !mine.bomb && !mine.flagged();
+    };
+
+    if (!board.inBounds(x, y) || !canOpen(board.get(x, y)))
+        return 0;
+
+    board.get(x, y).state = Mine::State::Discovered;
+    std::size_t opened = 1;
+
+    std::vector<std::pair<int, int>> frontier;
+
+    if (board.get(x, y).neighbors == 0)
+        frontier.push_back({ x, y });
+
+    while (!frontier.empty()) {
+        auto [ cx, cy ] = frontier.back();
+        frontier.pop_back();
+
+        for (int j = -1; j <= 1; ++j) {
+            for (int i = -1; i <= 1; ++i) {
+                if (!board.inBounds(cx + i, cy + j))
+                    continue;
+
+                Mine& mine = board.get(cx + i, cy + j);
+
+                if (canOpen(mine)) {
+                    mine.state = Mine::State::Discovered;
+                    opened++;
+
+                    if (mine.neighbors == 0)
+                        frontier.push_back({ cx + i, cy + j });
+                }
+            }
+        }
+    }
+
+    return opened;
+}
+
+// The safe mines that are still hidden, counted mine by mine
+std::size_t countSafeLeft(const Minefield& board)
+{
+    std::size_t safeLeft = 0;
+
+    for (std::size_t y = 0; y < board.rows; ++y) {
+        for (std::size_t x = 0; x < board.cols; ++x)
+            safeLeft += !board.get(x, y).bomb && !board.get(x, y).discovered();
+    }
+
+    return safeLeft;
+}
+
+bool sameMines(const Minefield& board, const Minefield& expected)
+{
+    for (std::size_t y = 0; y < board.rows; ++y) {
+        for (std::size_t x = 0; x < board.cols; ++x) {
+            if (board.get(x, y).state != expected.get(x, y).state)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Plays the same random opens and flags on a board and on a copy that
+ * spreads mine by mine, and checks that they open the same mines. The 
+ * flags are also taken away again, so that openings are cut by flags, 
+ * partly opened, and then opened from another mine.
+ */
+void testOpenings()
+{
+    struct Size { std::size_t cols, rows, bombs; };
+
+    const Size sizes[] = { { 21, 1, 2 }, { 9, 9, 10 }, { 30, 16, 99 }, { 64, 3, 5 }, { 1, 50, 3 }, { 100, 100, 300 } };
+
+    Random::Engine engine { 5 };
+    bool same = true, counted = true, changed = true;
+
+    for (auto size : sizes) {
+        Minefield board { size.cols, size.rows, size.bombs }, expected { size.cols, size.rows, size.bombs };
+
+        for (std::uint64_t game = 0; game < 300; ++game) {
+            board.setSeed(game);
+            board.resetAll();
+            expected.setSeed(game);
+            expected.resetAll();
+
+            std::vector<std::pair<int, int>> flagged;
+
+            for (int move = 0; move < 40; ++move) {
+                int x = engine() % size.cols, y = engine() % size.rows;
+                int kind = engine() % 6;
+
+                if (kind < 3) {
+                    board.clearChanges();
+                    std::size_t opened = board.open(x, y);
+
+                    same = same && opened == spread(expected, x, y);
+                    changed = changed && (board.allChanged() || board.getChanges().size() >= opened);
+                }
+                else if (kind < 5) {
+                    board.flag(x, y);
+                    expected.flag(x, y);
+                    flagged.push_back({ x, y });
+                }
+                else if (!flagged.empty()) {
+                    auto [ fx, fy ] = flagged[engine() % flagged.size()];
+                    board.flag(fx, fy);
+                    expected.flag(fx, fy);
+                }
+            }
+
+            same = same && sameMines(board, expected);
+            counted = counted && board.getSafeLeft() == countSafeLeft(expected);
+        }
+    }
+
+    check(same, "an opening opens the same mines as spreading mine by mine");
+    check(counted, "opening an opening counts the safe mines that are left");
+    check(changed, "opening an opening marks every mine it opens as changed");
+}
+
+// A board that was partly played is labeled when it is loaded
+void testLoadedOpenings()
+{
+    const char * path = "test-openings.bin";
+
+    Minefield board { 40, 40, 150 }, expected { 40, 40, 150 };
+    board.setSeed(6);
+    board.resetAll();
+    expected.setSeed(6);
+    expected.resetAll();
+
+    Random::Engine engine { 6 };
+
+    for (int move = 0; move < 30; ++move) {
+        int x = engine() % 40, y = engine() % 40;
+        board.flag(x, y);
+        expected.flag(x, y);
+    }
+
+    board.save(path);
+    Minefield loaded = Minefield::load(path);
+
+    bool same = true;
+
+    for (int move = 0; move < 200; ++move) {
+        int x = engine() % 40, y = engine() % 40;
+
+        if (move % 3 == 0) {
+            loaded.flag(x, y);
+            expected.flag(x, y);
+        }
+        else
+            same = same && loaded.open(x, y) == spread(expected, x, y);
+    }
+
+    check(same && sameMines(loaded, expected), "a loaded board opens the same mines as spreading mine by mine");
+
+    std::remove(path);
+}
+
+/**
+ * A snapshot whose size in its header doesn't fit the file is rejected,
+ * even if the size overflows to the size of the file
+ */
+void testCraftedHeader()
+{
+    const char * path = "test-header.bin";
+
+    Minefield board { 9, 9, 10 };
+    board.save(path);
+
+    char header[64];
+    std::ifstream { path, std::ios::binary }.read(header, sizeof(header));
+
+    // The cols and rows are at 16 and 24, and a board of 2^32 by 2^32 
+    // mines wraps around to no mines, which is a file of just the header
+    auto rejects = [&](std::uint64_t cols, std::uint64_t rows) {
+        std::memcpy(header + 16, &cols, sizeof(cols));
+        std::memcpy(header + 24, &rows, sizeof(rows));
+        std::memset(header + 32, 0, sizeof(std::uint64_t));
+        std::ofstream { path, std::ios::binary }.write(header, sizeof(header));
+
+        try {
+            Minefield::load(path);
+        }
+        catch (const std::runtime_error&) {
+            return true;
+        }
+
+        return false;
+    };
+
+    check(rejects(std::uint64_t(1) << 32, std::uint64_t(1) << 32), "a snapshot whose size overflows is rejected");
+    check(rejects(0, 9), "a snapshot without columns is rejected");
+
+    std::remove(path);
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 tests/minefield.cpp src/mine.cpp src/minefield.cpp src/utils/mapped_file.cpp
+    */
+
+    testLoss();
+    testGiveUp();
+    testLoadedLoss();
+    testSeededBombs();
+    testWin();
+    testOpenings();
+    testLoadedOpenings();
+    testCraftedHeader();
+
+    if (failures > 0)
+        return 1;
+
+    std::cout << "All checks passed\n";
+    return 0;
+}
+/////////
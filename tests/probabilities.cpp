@@ -0,0 +1,225 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../headers/probabilities.hpp"
+
+/**
+ * Checks the probabilities of `Probabilities` against every placement of
+ * the bombs on small boards, and that a component too long to count in
+ * a double still gives probabilities. Prints every check that fails, and
+ * exits with 1 if any did.
+ */
+
+int failures = 0;
+
+void check(bool condition, const std::string& name)
+{
+    if (!condition) {
+        std::cout << "FAILED: " << name << "\n";
+        failures++;
+    }
+}
+
+/**
+ * Tries every placement of the bombs of a board, and counts how often
+ * each mine is a bomb in the placements that fit the discovered mines
+ */
+std::vector<double> bruteForce(const Minefield& board)
+{
+    const int cols = board.cols, rows = board.rows;
+    std::vector<double> bombs(cols * rows, 0.0);
+    double placements = 0;
+
+    std::vector<char> bomb(cols * rows, 0);
+
+    auto fits = [&]() {
+        for (int y = 0; y < rows; ++y) {
+            for (int x = 0; x < cols; ++x) {
+                const Mine& mine = board.get(x, y);
+
+                if (!mine.discovered())
+                    continue;
+
+                if (bomb[y * cols + x])
+                    return false;
+
+                int neighbors = 0;
+
+                for (int j = -1; j <= 1; ++j) {
+                    for (int i = -1; i <= 1; ++i) {
+                        if (board.inBounds(x + i, y + j))
+                            neighbors += bomb[(y + j) * cols + x + i];
+                    }
+                }
+
+                if (neighbors != mine.neighbors)
+                    return false;
+            }
+        }
+
+        return true;
+    };
+
+    auto place = [&](auto& place, int start, int left) -> void {
+        if (left == 0) {
+            if (!fits())
+                return;
+
+            placements++;
+
+            for (int index = 0; index < cols * rows; ++index)
+                bombs[index] += bomb[index];
+
+            return;
+        }
+
+        for (int index = start; index <= cols * rows - left; ++index) {
+            bomb[index] = 1;
+            place(place, index + 1, left - 1);
+            bomb[index] = 0;
+        }
+    };
+
+    place(place, 0, board.bombs);
+
+    for (auto& value : bombs)
+        value /= placements;
+
+    return bombs;
+}
+
+/**
+ * Plays a few safe reveals and flags on small boards, and compares every
+ * probability with the placements that fit
+ */
+void testBruteForce()
+{
+    Random::Engine engine { 3 };
+    double worst = 0;
+
+    for (int game = 0; game < 300; ++game) {
+        std::size_t cols = 5 + engine() % 2, rows = 5, bombs = 3 + engine() % 4;
+
+        Minefield board { cols, rows, bombs };
+        board.setSeed(game);
+        board.resetAll(engine() % cols, engine() % rows);
+
+        Probabilities probabilities { board };
+
+        for (int move = 0, moves = 1 + engine() % 4; move < moves; ++move) {
+            std::vector<std::size_t> safe;
+
+            for (std::size_t index = 0; index < cols * rows; ++index) {
+                const Mine& mine = board.get(index % cols, index / cols);
+
+                if (!mine.bomb && !mine.discovered())
+                    safe.push_back(index);
+            }
+
+            if (safe.empty())
+                break;
+
+            std::size_t index = safe[engine() % safe.size()];
+            board.reveal(index % cols, index / cols);
+
+            // A flag is treated as a hidden mine, right or wrong
+            if (engine() % 3 == 0) {
+                std::size_t flag = engine() % (cols * rows);
+                board.flag(flag % cols, flag / cols);
+            }
+        }
+
+        probabilities.update();
+
+        auto expected = bruteForce(board);
+
+        for (std::size_t index = 0; index < cols * rows; ++index)
+            worst = std::max(worst, std::abs(expected[index] - probabilities.get(index % cols, index / cols)));
+    }
+
+    check(worst < 1e-9, "the probabilities are those of every placement that fits");
+}
+
+/**
+ * A row of discovered mines between two rows of hidden mines is a single
+ * component with more arrangements than a double holds. The chances of
+ * the mines around each count still add up to the count.
+ */
+void testLongComponent()
+{
+    const std::size_t cols = 2000;
+    std::vector<char> bomb(cols * 3, 0);
+
+    Random::Engine engine { 9 };
+    std::size_t bombs = 0;
+
+    for (std::size_t x = 0; x < cols; ++x) {
+        for (std::size_t y : { 0, 2 }) {
+            bomb[y * cols + x] = engine() % 2;
+            bombs += bomb[y * cols + x];
+        }
+    }
+
+    Minefield board { cols, 3, bombs };
+
+    for (std::size_t y = 0; y < 3; ++y) {
+        for (std::size_t x = 0; x < cols; ++x) {
+            Mine& mine = board.get(x, y);
+
+            mine.bomb = bomb[y * cols + x];
+            mine.state = y == 1 ? Mine::Discovered : Mine::Default;
+        }
+    }
+
+    for (std::size_t x = 0; x < cols; ++x) {
+        int neighbors = 0;
+
+        for (int i = -1; i <= 1; ++i) {
+            if (board.inBounds(x + i, 0))
+                neighbors += bomb[x + i] + bomb[2 * cols + x + i];
+        }
+
+        board.get(x, 1).neighbors = neighbors;
+    }
+
+    Probabilities probabilities { board };
+    probabilities.update();
+
+    bool sums = true;
+
+    for (std::size_t x = 0; x < cols; ++x) {
+        double sum = 0;
+
+        for (int i = -1; i <= 1; ++i) {
+            if (board.inBounds(x + i, 0))
+                sum += probabilities.get(x + i, 0) + probabilities.get(x + i, 2);
+        }
+
+        // A NaN fails this too
+        sums = sums && std::abs(sum - board.get(x, 1).neighbors) < 1e-6;
+    }
+
+    check(probabilities.getComponentCount() == 1, "the hidden rows are a single component");
+    check(sums, "the chances around each count of a long component add up to the count");
+}
+
+/////////
+int main()
+{
+
+    /*
+    g++ -O2 -std=c++17 tests/probabilities.cpp src/mine.cpp src/minefield.cpp src/probabilities.cpp src/utils/mapped_file.cpp
+    */
+
+    testBruteForce();
+    testLongComponent();
+
+    if (failures > 0)
+        return 1;
+
+    std::cout << "All checks passed\n";
+    return 0;
+}
+/////////
@@ -0,0 +1,164 @@
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../headers/analytics.hpp"
+#include "../headers/difficulty.hpp"
+#include "../headers/utils/batches.hpp"
+
+/**
+ * Rates many seeded boards of each difficulty by their 3BV, openings
+ * and isolated numbers on every core, and writes the histograms of the
+ * metrics to a file.
+ *
+ * The boards are split into batches with `Batches::run`, so the 
+ * histograms don't depend on the number of threads. Each thread adds to
+ * histograms of its own, which are added together once every batch is 
+ * done.
+ */
+
+/**
+ * The board, the analytics and the histograms that a thread reuses
+ */
+struct Table
+{
+    Minefield board;
+    Analytics analytics;
+    Analytics::Histograms histograms;
+
+    Table(const Difficulty& difficulty) :
+        board { difficulty.cols, difficulty.rows, difficulty.bombs },
+        histograms { difficulty.cols, difficulty.rows, difficulty.bombs }
+    {
+    }
+};
+
+// The mean and a percentile of the values of a histogram
+double getMean(const std::vector<std::uint64_t>& counts, std::uint64_t total)
+{
+    double sum = 0;
+
+    for (std::size_t value = 0; value < counts.size(); ++value)
+        sum += (double) value * counts[value];
+
+    return total ? sum / total : 0;
+}
+
+std::size_t getPercentile(const std::vector<std::uint64_t>& counts, std::uint64_t total, double percentile)
+{
+    std::uint64_t seen = 0;
+
+    for (std::size_t value = 0; value < counts.size(); ++value) {
+        seen += counts[value];
+
+        if (seen > percentile * total)
+            return value;
+    }
+
+    return counts.empty() ? 0 : counts.size() - 1;
+}
+
+/////////
+int main(int argc, char ** argv)
+{
+
+    /*
+    g++ -O2 -std=c++17 -pthread tools/analyze.cpp libminesweeper-core.a
+
+    ./a.out [easy | intermediate | expert | <cols> <rows> <bombs>]...
+        [--boards <per difficulty>] [--seed <seed>] [--threads <threads>] [--batch <boards>] [--out <path>]
+    */
+
+    std::uint64_t boardCount = 1000000, batch = 4096;
+    std::uint64_t seed = Random::getSeed();
+    std::size_t threads = std::thread::hardware_concurrency();
+    std::string path = "analytics.bin";
+
+    std::vector<std::string> words;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--boards") == 0 && i + 1 < argc)
+                boardCount = std::stoull(argv[++i]);
+            else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+                seed = std::stoull(argv[++i]);
+            else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+                threads = std::stoul(argv[++i]);
+            else if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc)
+                batch = std::max<std::uint64_t>(std::stoull(argv[++i]), 1);
+            else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+                path = argv[++i];
+            else
+                words.push_back(argv[i]);
+        }
+
+        if (words.empty())
+            words = { "easy", "intermediate", "expert" };
+
+        auto difficulties = Difficulty::parse(words);
+
+        ThreadPool pool { threads };
+
+        std::cout << "Seed " << seed << ", " << pool.getThreadCount() << " threads\n";
+        std::cout << "board\tboards\tboards/s\t3BV mean\t3BV p50\t3BV p99\topenings mean\tisolated mean\n";
+
+        std::vector<Analytics::Histograms> results;
+
+        for (const auto& entry : difficulties) {
+            const std::string& name = entry.first;
+            const Difficulty& difficulty = entry.second;
+
+            auto start = std::chrono::steady_clock::now();
+
+            auto tables = Batches::run(
+                pool, boardCount, batch, seed,
+                [&] { return std::make_unique<Table>(difficulty); },
+                [](Table& table, Random::Engine& engine, std::uint64_t count) {
+                    Minefield& board = table.board;
+
+                    // The boards are placed around a first click in the middle,
+                    // like the boards of a game
+                    for (std::uint64_t i = 0; i < count; ++i) {
+                        board.setSeed(engine());
+                        board.resetAll(board.cols / 2, board.rows / 2);
+
+                        table.histograms.add(table.analytics.analyze(board));
+                    }
+                }
+            );
+
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            Analytics::Histograms total { difficulty.cols, difficulty.rows, difficulty.bombs };
+
+            for (const auto& table : tables) {
+                if (table)
+                    total.add(table->histograms);
+            }
+
+            std::cout << name << "\t" << total.boards << "\t"
+                      << total.boards / elapsed.count() << "\t"
+                      << getMean(total.bbbv, total.boards) << "\t"
+                      << getPercentile(total.bbbv, total.boards, 0.5) << "\t"
+                      << getPercentile(total.bbbv, total.boards, 0.99) << "\t"
+                      << getMean(total.openings, total.boards) << "\t"
+                      << getMean(total.isolated, total.boards) << "\n";
+
+            results.push_back(std::move(total));
+        }
+
+        Analytics::save(path, results);
+        std::cout << "Wrote the histograms to " << path << "\n";
+    }
+
+    catch (const std::exception& error) {
+        std::cout << error.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
+/////////
@@ -0,0 +1,314 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../headers/difficulty.hpp"
+#include "../headers/utils/random_engine.hpp"
+
+/**
+ * Puts a server from `tools/server.cpp` under a synthetic load, and
+ * reports the moves per second that it answers and the latency of each
+ * move.
+ *
+ * Every connection has a thread that starts many games, then sends a
+ * move for each of them at once, reads the answers and starts again,
+ * until the time is up. The moves open or flag random mines, and a game
+ * that is over is restarted instead. The latency of a move is from when
+ * its round was sent to when its answer was read, so it includes the
+ * wait for the moves before it in the same round.
+ */
+
+/**
+ * What a connection did, and the latency of each of its moves in
+ * microseconds
+ */
+struct Results
+{
+    std::uint64_t moves = 0, won = 0, lost = 0;
+    std::vector<float> latencies;
+    std::exception_ptr error;
+};
+
+int connectTo(const std::string& path)
+{
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+
+    if (path.size() >= sizeof(address.sun_path))
+        throw std::runtime_error("The socket path is too long: " + path);
+
+    std::strcpy(address.sun_path, path.c_str());
+
+    int server = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (server < 0 || ::connect(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        if (server >= 0)
+            ::close(server);
+
+        throw std::runtime_error("Could not connect to " + path);
+    }
+
+    return server;
+}
+
+void sendAll(int server, const std::string& data)
+{
+    for (std::size_t sent = 0; sent < data.size(); ) {
+        ssize_t size = ::write(server, data.data() + sent, data.size() - sent);
+
+        if (size <= 0)
+            throw std::runtime_error("Could not send to the server");
+
+        sent += size;
+    }
+}
+
+/**
+ * Reads the answers of a server a line at a time. A line is valid until
+ * the next one is read.
+ */
+class LineReader
+{
+
+    int server;
+    std::string buffer;
+    std::size_t start = 0;
+
+public:
+
+    LineReader(int server) : server { server } {}
+
+    std::string_view next()
+    {
+        std::size_t end;
+
+        while ((end = buffer.find('\n', start)) == std::string::npos) {
+            buffer.erase(0, start);
+            start = 0;
+
+            char chunk[1 << 16];
+            ssize_t size = ::read(server, chunk, sizeof(chunk));
+
+            if (size <= 0)
+                throw std::runtime_error("The server closed the connection");
+
+            buffer.append(chunk, size);
+        }
+
+        std::string_view line = std::string_view(buffer).substr(start, end - start);
+        start = end + 1;
+
+        return line;
+    }
+
+};
+
+// Plays games on one connection until a deadline
+void play(
+    const std::string& path, const Difficulty& difficulty, std::size_t games,
+    std::chrono::steady_clock::time_point deadline, Random::Engine engine, Results& results)
+{
+    int server = connectTo(path);
+    LineReader reader { server };
+
+    std::string round;
+
+    for (std::size_t game = 0; game < games; ++game) {
+        round += "new " + std::to_string(difficulty.cols) + " " + std::to_string(difficulty.rows) + " " +
+                 std::to_string(difficulty.bombs) + " " + std::to_string(engine()) + "\n";
+    }
+
+    sendAll(server, round);
+
+    std::vector<std::string> ids(games);
+    std::vector<bool> over(games, false), moved(games);
+
+    for (std::size_t game = 0; game < games; ++game) {
+        std::string_view line = reader.next();
+
+        if (line.substr(0, 5) != "game ")
+            throw std::runtime_error("Could not start a game: " + std::string(line));
+
+        ids[game] = line.substr(5);
+    }
+
+    while (std::chrono::steady_clock::now() < deadline) {
+        round.clear();
+
+        for (std::size_t game = 0; game < games; ++game) {
+            moved[game] = !over[game];
+
+            if (over[game]) {
+                round += "restart " + ids[game] + "\n";
+                continue;
+            }
+
+            // One move in five is a flag
+            round += engine() % 5 == 0 ? "flag " : "open ";
+            round += ids[game] + " " + std::to_string(engine() % difficulty.cols) + " " +
+                     std::to_string(engine() % difficulty.rows) + "\n";
+        }
+
+        auto sent = std::chrono::steady_clock::now();
+        sendAll(server, round);
+
+        for (std::size_t game = 0; game < games; ++game) {
+            std::string_view line = reader.next();
+            std::chrono::duration<float, std::micro> latency = std::chrono::steady_clock::now() - sent;
+
+            if (line.substr(0, 6) == "error ")
+                throw std::runtime_error("The server answered " + std::string(line));
+
+            bool won = line.substr(0, 4) == "won ", lost = line.substr(0, 5) == "lost ";
+
+            if (moved[game]) {
+                results.moves++;
+                results.latencies.push_back(latency.count());
+
+                results.won += won && !over[game];
+                results.lost += lost && !over[game];
+            }
+
+            over[game] = won || lost;
+        }
+    }
+
+    // The games outlive the connection unless they are closed
+    round.clear();
+
+    for (std::size_t game = 0; game < games; ++game)
+        round += "close " + ids[game] + "\n";
+
+    sendAll(server, round);
+
+    for (std::size_t game = 0; game < games; ++game)
+        reader.next();
+
+    ::close(server);
+}
+
+// A percentile of latencies that are sorted
+float getPercentile(const std::vector<float>& sorted, double percentile)
+{
+    if (sorted.empty())
+        return 0;
+
+    return sorted[std::min<std::size_t>(percentile * sorted.size(), sorted.size() - 1)];
+}
+
+/////////
+int main(int argc, char ** argv)
+{
+
+    /*
+    g++ -O2 -std=c++17 -pthread tools/client.cpp libminesweeper-core.a -o client
+
+    ./client [easy | intermediate | expert | <cols> <rows> <bombs>]... --socket <path>
+        [--connections <connections>] [--games <per connection>] [--seconds <seconds>] [--seed <seed>]
+    */
+
+    std::string path;
+    std::size_t connections = 4, games = 1000;
+    double seconds = 5;
+    std::uint64_t seed = Random::getSeed();
+
+    std::vector<std::string> words;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--socket") == 0 && i + 1 < argc)
+                path = argv[++i];
+            else if (std::strcmp(argv[i], "--connections") == 0 && i + 1 < argc)
+                connections = std::max<std::size_t>(std::stoul(argv[++i]), 1);
+            else if (std::strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+                games = std::max<std::size_t>(std::stoul(argv[++i]), 1);
+            else if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc)
+                seconds = std::stod(argv[++i]);
+            else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+                seed = std::stoull(argv[++i]);
+            else
+                words.push_back(argv[i]);
+        }
+
+        if (path.empty())
+            throw std::runtime_error("The server needs a --socket");
+
+        if (words.empty())
+            words = { "intermediate" };
+
+        auto difficulties = Difficulty::parse(words);
+
+        std::cout << "Seed " << seed << ", " << connections << " connections of " << games << " games\n";
+        std::cout << "board\tmoves\tmoves/s\tp50 (us)\tp99 (us)\tmax (us)\twon\tlost\n";
+
+        for (const auto& entry : difficulties) {
+            const std::string& name = entry.first;
+            const Difficulty& difficulty = entry.second;
+
+            std::vector<Results> results(connections);
+            std::vector<std::thread> threads;
+
+            auto start = std::chrono::steady_clock::now();
+            auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(seconds)
+            );
+
+            // Every connection gets a stream of seeds and moves that never overlaps the others
+            for (std::size_t c = 0; c < connections; ++c) {
+                threads.emplace_back([&, c] {
+                    try {
+                        play(path, difficulty, games, deadline, Random::getStream(seed, c), results[c]);
+                    }
+                    catch (...) {
+                        results[c].error = std::current_exception();
+                    }
+                });
+            }
+
+            for (std::thread& thread : threads)
+                thread.join();
+
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            Results total;
+
+            for (Results& result : results) {
+                if (result.error)
+                    std::rethrow_exception(result.error);
+
+                total.moves += result.moves;
+                total.won += result.won;
+                total.lost += result.lost;
+                total.latencies.insert(total.latencies.end(), result.latencies.begin(), result.latencies.end());
+            }
+
+            std::sort(total.latencies.begin(), total.latencies.end());
+
+            std::cout << name << "\t" << total.moves << "\t"
+                      << total.moves / elapsed.count() << "\t"
+                      << getPercentile(total.latencies, 0.5) << "\t"
+                      << getPercentile(total.latencies, 0.99) << "\t"
+                      << getPercentile(total.latencies, 1.0) << "\t"
+                      << total.won << "\t" << total.lost << "\n";
+        }
+    }
+
+    catch (const std::exception& error) {
+        std::cout << error.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
+/////////
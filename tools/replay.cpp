@@ -0,0 +1,76 @@
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+#include "../headers/journal.hpp"
+
+/**
+ * Plays a journal that was recorded with `--journal` again without a
+ * window, and prints the outcome of every game in it, so that a score
+ * can be checked. The journal can be played many times over to profile
+ * the moves of a real session.
+ */
+
+/////////
+int main(int argc, char ** argv)
+{
+
+    /*
+    g++ -O2 -std=c++17 tools/replay.cpp libminesweeper-core.a
+
+    ./a.out <journal> [--repeat <times>]
+    */
+
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0] << " <journal> [--repeat <times>]\n";
+        return 1;
+    }
+
+    std::size_t repeat = 1;
+
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = std::stoul(argv[++i]);
+    }
+
+    try {
+        Replay replay { argv[1] };
+        Minefield board { replay.cols, replay.rows, replay.bombs };
+
+        std::cout << "Journal of " << replay.getMoveCount() << " moves on a "
+                  << replay.cols << "x" << replay.rows << " board with " << replay.bombs << " bombs\n";
+
+        auto games = replay.play(board);
+
+        std::cout << "game\tseed\tclicks\topened\toutcome\ttime (s)\n";
+
+        for (std::size_t i = 0; i < games.size(); ++i) {
+            const auto& game = games[i];
+
+            std::cout << i << "\t" << game.seed << "\t" << game.clicks << "\t" << game.opened << "\t"
+                      << (game.won ? "won" : game.lost ? "lost" : "unfinished") << "\t"
+                      << (game.end - game.start) / 1000.0 << "\n";
+        }
+
+        // Every game resets the board, so the board the last
+        // play left behind doesn't matter
+        auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < repeat; ++i)
+            replay.play(board);
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << "Replayed " << repeat << " times in " << elapsed.count() * 1000.0 << " ms, "
+                  << repeat * replay.getMoveCount() / elapsed.count() << " moves/s\n";
+    }
+
+    catch (const std::exception& error) {
+        std::cout << error.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
+/////////
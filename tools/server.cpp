@@ -0,0 +1,323 @@
+#include <iostream>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../headers/server.hpp"
+
+/**
+ * Hosts games for many clients at once over a Unix socket, or for one
+ * client over stdin and stdout, with the line protocol of `Server`.
+ *
+ * A single thread waits on every connection with poll, reads whatever
+ * each of them sent, and plays the complete lines of all of them as one
+ * batch, which the `Server` spreads over its threads. The answers to a
+ * connection are sent with one write, in the order of its requests. A
+ * connection that doesn't read its answers isn't read from until it has
+ * caught up, so a slow client can't make the server buffer without end.
+ */
+
+struct Connection
+{
+    int in, out;
+
+    // The bytes read that aren't a whole line yet, and the answers that weren't sent
+    std::string input, output;
+    std::size_t sent = 0;
+
+    // The input ended, or the connection can't be used anymore
+    bool ended = false, broken = false;
+
+    // The requests of the connection in the batch
+    std::size_t first = 0, count = 0, consumed = 0;
+
+    // The entries of the connection in the list of polled files
+    int polledIn = -1, polledOut = -1;
+
+    Connection(int in, int out) : in { in }, out { out } {}
+};
+
+// Answers that aren't sent past this stop a connection from being read
+const std::size_t MAX_PENDING = 1 << 20;
+
+// A line can't be longer than this
+const std::size_t MAX_LINE = 1 << 16;
+
+volatile std::sig_atomic_t stopping = 0;
+
+void stop(int)
+{
+    stopping = 1;
+}
+
+void setNonBlocking(int file)
+{
+    ::fcntl(file, F_SETFL, ::fcntl(file, F_GETFL) | O_NONBLOCK);
+}
+
+int listenOn(const std::string& path)
+{
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+
+    if (path.size() >= sizeof(address.sun_path))
+        throw std::runtime_error("The socket path is too long: " + path);
+
+    std::strcpy(address.sun_path, path.c_str());
+
+    // A socket left behind by a server that didn't stop cleanly
+    ::unlink(path.c_str());
+
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (listener < 0 ||
+        ::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listener, SOMAXCONN) != 0)
+        throw std::runtime_error("Could not listen on " + path);
+
+    setNonBlocking(listener);
+    return listener;
+}
+
+// Reads everything that a connection sent so far
+void receive(Connection& connection)
+{
+    char buffer[1 << 16];
+
+    while (true) {
+        ssize_t size = ::read(connection.in, buffer, sizeof(buffer));
+
+        if (size > 0)
+            connection.input.append(buffer, size);
+        else if (size < 0 && errno == EINTR)
+            continue;
+        else {
+            if (size == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+                connection.ended = true;
+
+            return;
+        }
+    }
+}
+
+// Writes as many of the answers to a connection as it takes
+void send(Connection& connection)
+{
+    while (connection.sent < connection.output.size()) {
+        ssize_t size = ::write(
+            connection.out,
+            connection.output.data() + connection.sent,
+            connection.output.size() - connection.sent
+        );
+
+        if (size < 0 && errno == EINTR)
+            continue;
+
+        if (size < 0) {
+            connection.broken = errno != EAGAIN && errno != EWOULDBLOCK;
+            return;
+        }
+
+        connection.sent += size;
+    }
+
+    connection.output.clear();
+    connection.sent = 0;
+}
+
+/////////
+int main(int argc, char ** argv)
+{
+
+    /*
+    g++ -O2 -std=c++17 -pthread tools/server.cpp libminesweeper-core.a -o server
+
+    ./server [--socket <path>] [--threads <threads>]
+    */
+
+    std::string path;
+    std::size_t threads = std::thread::hardware_concurrency();
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--socket") == 0 && i + 1 < argc)
+                path = argv[++i];
+            else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+                threads = std::stoul(argv[++i]);
+            else
+                throw std::runtime_error(std::string("Unknown argument ") + argv[i]);
+        }
+
+        std::signal(SIGINT, stop);
+        std::signal(SIGTERM, stop);
+
+        // A client that goes away shows up as a failed write instead
+        std::signal(SIGPIPE, SIG_IGN);
+
+        Server server { threads };
+
+        int listener = -1;
+        std::vector<Connection> connections;
+
+        if (path.empty()) {
+            connections.emplace_back(STDIN_FILENO, STDOUT_FILENO);
+            std::cerr << "Serving stdin";
+        }
+        else {
+            listener = listenOn(path);
+            std::cerr << "Listening on " << path;
+        }
+
+        std::cerr << " with " << server.getThreadCount() << " threads\n";
+
+        for (Connection& connection : connections) {
+            setNonBlocking(connection.in);
+            setNonBlocking(connection.out);
+        }
+
+        std::vector<pollfd> polled;
+        std::vector<Server::Request> requests;
+        std::uint64_t requestCount = 0, batchCount = 0, connectionCount = connections.size();
+
+        while (!stopping) {
+            polled.clear();
+
+            if (listener >= 0)
+                polled.push_back({ listener, POLLIN, 0 });
+
+            for (Connection& connection : connections) {
+                connection.polledIn = connection.polledOut = -1;
+
+                bool reading = !connection.ended && connection.output.size() - connection.sent < MAX_PENDING;
+                bool writing = connection.sent < connection.output.size();
+
+                if (reading) {
+                    connection.polledIn = polled.size();
+                    polled.push_back({ connection.in, POLLIN, 0 });
+                }
+
+                if (writing && connection.in == connection.out && reading)
+                    polled[connection.polledIn].events |= POLLOUT;
+                else if (writing) {
+                    connection.polledOut = polled.size();
+                    polled.push_back({ connection.out, POLLOUT, 0 });
+                }
+            }
+
+            if (::poll(polled.data(), polled.size(), -1) < 0) {
+                if (errno == EINTR)
+                    continue;
+
+                throw std::runtime_error("Could not wait for the connections");
+            }
+
+            if (listener >= 0 && polled[0].revents & POLLIN) {
+                int client;
+
+                while ((client = ::accept(listener, nullptr, nullptr)) >= 0) {
+                    setNonBlocking(client);
+                    connections.emplace_back(client, client);
+                    connectionCount++;
+                }
+            }
+
+            // Every line that came in on any connection is in the same batch
+            requests.clear();
+
+            for (Connection& connection : connections) {
+                if (connection.polledIn >= 0 && polled[connection.polledIn].revents)
+                    receive(connection);
+
+                connection.first = requests.size();
+
+                std::size_t start = 0, end;
+
+                while ((end = connection.input.find('\n', start)) != std::string::npos) {
+                    requests.push_back({ std::string_view(connection.input).substr(start, end - start), {} });
+                    start = end + 1;
+                }
+
+                // The last line of an input doesn't need a newline
+                if (connection.ended && start < connection.input.size()) {
+                    requests.push_back({ std::string_view(connection.input).substr(start), {} });
+                    start = connection.input.size();
+                }
+
+                connection.count = requests.size() - connection.first;
+                connection.consumed = start;
+
+                if (connection.input.size() - start > MAX_LINE) {
+                    std::cerr << "Closing a connection that sent a line that is too long\n";
+                    connection.broken = true;
+                }
+            }
+
+            if (!requests.empty()) {
+                server.handle(requests);
+
+                requestCount += requests.size();
+                batchCount++;
+            }
+
+            for (std::size_t i = 0; i < connections.size(); ) {
+                Connection& connection = connections[i];
+
+                // The lines were used by the requests until they were answered
+                connection.input.erase(0, connection.consumed);
+
+                for (std::size_t r = connection.first; r < connection.first + connection.count; ++r) {
+                    connection.output += requests[r].response;
+                    connection.output += '\n';
+                }
+
+                if (!connection.broken)
+                    send(connection);
+
+                bool done = connection.broken || (connection.ended && connection.sent == connection.output.size());
+
+                if (!done) {
+                    ++i;
+                    continue;
+                }
+
+                // The server stops with the input of stdin
+                if (listener < 0)
+                    stopping = 1;
+                else
+                    ::close(connection.in);
+
+                connections.erase(connections.begin() + i);
+            }
+        }
+
+        for (Connection& connection : connections) {
+            if (listener >= 0)
+                ::close(connection.in);
+        }
+
+        if (listener >= 0) {
+            ::close(listener);
+            ::unlink(path.c_str());
+        }
+
+        std::cerr << "Answered " << requestCount << " requests in " << batchCount << " batches from "
+                  << connectionCount << " connections, " << server.getGameCount() << " games left open\n";
+    }
+
+    catch (const std::exception& error) {
+        std::cerr << error.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
+/////////
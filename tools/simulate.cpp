@@ -0,0 +1,170 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../headers/difficulty.hpp"
+#include "../headers/solver.hpp"
+#include "../headers/utils/batches.hpp"
+
+/**
+ * Estimates the win rate of the `Solver` by playing many games without a
+ * window on every core.
+ *
+ * The games are split into batches with `Batches::run`, so a run with
+ * the same seed gives the same results on any number of threads. Each 
+ * thread reuses one board and one solver, and counts the results of its
+ * own games, which are added together once every batch is done.
+ */
+
+/**
+ * The totals of games, of one thread or of a configuration
+ */
+struct Totals
+{
+    std::uint64_t games = 0, won = 0, lost = 0, moves = 0;
+
+    void add(const Totals& other)
+    {
+        games += other.games;
+        won += other.won;
+        lost += other.lost;
+        moves += other.moves;
+    }
+};
+
+/**
+ * The board and the solver that a thread reuses, and the totals of the
+ * games it played
+ */
+struct Table
+{
+    Minefield board;
+    Solver solver;
+    Totals totals;
+
+    Table(const Difficulty& difficulty, bool guessing) :
+        board { difficulty.cols, difficulty.rows, difficulty.bombs },
+        solver { guessing }
+    {
+    }
+};
+
+/**
+ * The Wilson score interval of a rate with 95% confidence
+ */
+std::pair<double, double> getInterval(std::uint64_t successes, std::uint64_t trials)
+{
+    if (trials == 0)
+        return { 0.0, 1.0 };
+
+    const double z = 1.96;
+    double n = trials, p = successes / n;
+
+    double denominator = 1 + z * z / n;
+    double center = (p + z * z / (2 * n)) / denominator;
+    double spread = z * std::sqrt(p * (1 - p) / n + z * z / (4 * n * n)) / denominator;
+
+    return { center - spread, center + spread };
+}
+
+/////////
+int main(int argc, char ** argv)
+{
+
+    /*
+    g++ -O2 -std=c++17 -pthread tools/simulate.cpp src/utils/thread_pool.cpp libminesweeper-core.a
+
+    ./a.out [easy | intermediate | expert | <cols> <rows> <bombs>]...
+        [--games <per difficulty>] [--seed <seed>] [--threads <threads>] [--batch <games>] [--no-guess]
+    */
+
+    std::uint64_t games = 100000, batch = 256;
+    std::uint64_t seed = Random::getSeed();
+    std::size_t threads = std::thread::hardware_concurrency();
+    bool guessing = true;
+
+    std::vector<std::string> words;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+                games = std::stoull(argv[++i]);
+            else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+                seed = std::stoull(argv[++i]);
+            else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+                threads = std::stoul(argv[++i]);
+            else if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc)
+                batch = std::max<std::uint64_t>(std::stoull(argv[++i]), 1);
+            else if (std::strcmp(argv[i], "--no-guess") == 0)
+                guessing = false;
+            else
+                words.push_back(argv[i]);
+        }
+
+        if (words.empty())
+            words = { "easy", "intermediate", "expert" };
+
+        auto difficulties = Difficulty::parse(words);
+
+        ThreadPool pool { threads };
+
+        std::cout << "Seed " << seed << ", " << pool.getThreadCount() << " threads"
+                  << (guessing ? "" : ", the solver never guesses") << "\n";
+        std::cout << "board\tgames\twon\twin rate\t95% interval\tgames/s\tmoves/s\n";
+
+        for (const auto& entry : difficulties) {
+            const std::string& name = entry.first;
+            const Difficulty& difficulty = entry.second;
+
+            auto start = std::chrono::steady_clock::now();
+
+            auto tables = Batches::run(
+                pool, games, batch, seed,
+                [&] { return std::make_unique<Table>(difficulty, guessing); },
+                [](Table& table, Random::Engine& engine, std::uint64_t count) {
+                    Minefield& board = table.board;
+
+                    for (std::uint64_t game = 0; game < count; ++game) {
+                        board.setSeed(engine());
+
+                        auto result = table.solver.play(board, board.cols / 2, board.rows / 2);
+
+                        table.totals.games++;
+                        table.totals.won += result.won;
+                        table.totals.lost += result.lost;
+                        table.totals.moves += result.moves;
+                    }
+                }
+            );
+
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            Totals totals;
+
+            for (const auto& table : tables) {
+                if (table)
+                    totals.add(table->totals);
+            }
+
+            auto [ low, high ] = getInterval(totals.won, totals.games);
+
+            std::cout << name << "\t" << totals.games << "\t" << totals.won << "\t"
+                      << 100.0 * totals.won / totals.games << "%\t"
+                      << 100.0 * low << "% - " << 100.0 * high << "%\t"
+                      << totals.games / elapsed.count() << "\t"
+                      << totals.moves / elapsed.count() << "\n";
+        }
+    }
+
+    catch (const std::exception& error) {
+        std::cout << error.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
+/////////